@@ -12,6 +12,14 @@
 #           2017-09-22 Wheel Ver:0.1.5 [Heyn] New _crcx.
 #           2020-03-16 Wheel Ver:0.1.6 [Heyn] New hacker16 / hacker32 / hacker64.
 #           2020-04-17 Wheel Ver:1.1   [Heyn] New add CRC24
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add gil_threshold()
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add hacker_cache_info() / hacker_cache_clear()
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add Model
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add new() / algorithms_available, streaming CRC objects
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add combine()
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add extend_zeros()
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add records()
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add multi() / multi_new()
 
 from ._crcx  import *
 from ._canx  import *
@@ -21,3 +29,143 @@ from ._crc24 import *
 from ._crc32 import *
 from ._crc64 import *
 from ._crc82 import *
+from ._model import Model, Hasher, Multi
+
+from . import _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64, _model
+
+from collections import namedtuple as _namedtuple
+
+CacheInfo = _namedtuple( 'CacheInfo', 'hits misses maxsize currsize' )
+
+_CATALOGUE = {}
+for _module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64 ):
+    _CATALOGUE.update( _module._catalogue() )
+
+_MODELS = {}
+
+algorithms_available = frozenset( _CATALOGUE )
+
+# hacker name : ( width, poly, init, xorout, refin, refout ) defaults, and whether a reflected
+# init is taken as the raw register ( the CRC32 / CRC64 engines ) rather than reflected.
+_HACKER = { 'hacker8'  : ( ( 8,  0x31,               0xFF,       0x00,       False, False ), False ),
+            'hacker16' : ( ( 16, 0x8005,             0xFFFF,     0x0000,     True,  True  ), False ),
+            'hacker24' : ( ( 24, 0x800063,           0xFFFFFF,   0xFFFFFF,   False, False ), False ),
+            'hacker32' : ( ( 32, 0x04C11DB7,         0xFFFFFFFF, 0xFFFFFFFF, True,  True  ), True  ),
+            'hacker64' : ( ( 64, 0x42F0E1EBA9EA3693, 0x0,        0x0,        False, False ), True  ) }
+
+_HACKER_MODULES = ( ( 'hacker8', _crc8 ), ( 'hacker16', _crc16 ), ( 'hacker24', _crc24 ),
+                    ( 'hacker32', _crc32 ), ( 'hacker64', _crc64 ) )
+
+def gil_threshold( size=None ):
+    """ Get or set the buffer size (bytes) from which the GIL is released.
+        Returns the previous size.
+    """
+    modules = ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64, _model )
+    if size is None:
+        return _crc32._gil_threshold()
+
+    for module in modules:
+        previous = module._gil_threshold( size )
+    return previous
+
+def hacker_cache_info():
+    """ Table cache statistics of hacker8/16/24/32/64, as { 'hacker16' : CacheInfo, ... }.
+    """
+    return dict( ( name, CacheInfo( *module._cache_info() ) ) for name, module in _HACKER_MODULES )
+
+def hacker_cache_clear():
+    """ Empty the hacker table caches and reset their counters.
+    """
+    for _, module in _HACKER_MODULES:
+        module._cache_clear()
+
+def _catalogue_model( name ):
+    model = _MODELS.get( name )
+    if model is None:
+        if name not in _CATALOGUE:
+            raise ValueError( 'unsupported CRC model %r' % ( name, ) )
+        model = _MODELS.setdefault( name, Model( *_CATALOGUE[name] ) )
+    return model
+
+def new( name, data=None ):
+    """ Streaming CRC of a catalogue function, e.g. new( 'modbus' ) gives the same result as modbus().
+        Returns a Hasher with update() / digest() / hexdigest() / intdigest() / copy().
+    """
+    return _catalogue_model( name ).new( data )
+
+def _reflect( value, width ):
+    return int( bin( value )[2:].zfill( width )[::-1], 2 )
+
+def _hacker_model( name, poly=None, init=None, xorout=None, refin=None, refout=None ):
+    """ The Model computing hackerNN( data, poly, init, xorout, refin, refout ).
+    """
+    ( width, _poly, _init, _xorout, _refin, _refout ), raw = _HACKER[name]
+    poly   = _poly   if poly   is None else poly
+    init   = _init   if init   is None else init
+    xorout = _xorout if xorout is None else xorout
+    refin  = _refin  if refin  is None else refin
+    refout = _refout if refout is None else refout
+
+    # The hacker engines only reflect when both refin and refout are set.
+    reflected = bool( refin and refout )
+    if reflected and raw:
+        init = _reflect( init, width )
+    return Model( width, poly, init, xorout, reflected, reflected )
+
+def combine( name, crc_a, crc_b, len_b, **params ):
+    """ CRC of a+b from crc_a = name( a ), crc_b = name( b ) and len_b = len( b ), in O(log len_b).
+        name is a catalogue function ( libscrc.algorithms_available ) or hacker8/16/24/32/64,
+        the latter taking the same poly / init / xorout / refin / refout keywords.
+    """
+    if name in _HACKER:
+        return _hacker_model( name, **params ).combine( crc_a, crc_b, len_b )
+
+    if params:
+        raise TypeError( '%s takes no model parameters' % ( name, ) )
+
+    return _catalogue_model( name ).combine( crc_a, crc_b, len_b )
+
+def extend_zeros( name, crc, n, **params ):
+    """ CRC of the data behind crc = name( data ) followed by n zero bytes, in O(log n).
+        name and params as for combine().
+    """
+    if name in _HACKER:
+        return _hacker_model( name, **params ).extend_zeros( crc, n )
+
+    if params:
+        raise TypeError( '%s takes no model parameters' % ( name, ) )
+
+    return _catalogue_model( name ).extend_zeros( crc, n )
+
+_RECORDS = {}
+for _module in ( _crc16, _crc32 ):
+    _RECORDS.update( dict.fromkeys( _module._catalogue(), _module ) )
+
+def records( name, data, record_size, offset=0, length=None, check=None, byteorder='big', **kws ):
+    """ CRC of data[offset:offset+length] inside every record_size bytes of data, as array('H') / array('I').
+        name is a CRC16 or CRC32 catalogue function, length defaults to the rest of the record.
+        With check, the CRC stored big / little endian ( byteorder ) at that offset of every record is
+        verified instead and the indexes of the records that do not match come back as array('Q').
+        threads=N is keyword only, the default 0 is one thread per CPU.
+    """
+    module = _RECORDS.get( name )
+    if module is None:
+        raise ValueError( 'records() takes a CRC16 or CRC32 catalogue function, not %r' % ( name, ) )
+
+    return module._records( name, data, record_size, offset, length, check, byteorder, **kws )
+
+# Checksums Multi computes itself, everything else is a catalogue Model.
+_CHECKSUMS = ( 'adler32', )
+
+def multi_new( names, data=None ):
+    """ Streaming form of multi(), e.g. multi_new( [ 'crc32', 'adler32' ] ).
+        Returns a Multi with update() / intdigests() / hexdigests() / copy().
+    """
+    return Multi( [ ( name, name if name in _CHECKSUMS else _catalogue_model( name ) ) for name in names ], data )
+
+def multi( data, names ):
+    """ Several CRCs / checksums of data in one pass, e.g. multi( data, [ 'crc32', 'crc32_c', 'adler32', 'xz64' ] ).
+        The buffer is walked once in cache-sized blocks, every algorithm sees a block while it is still hot.
+        Returns { name : value }.
+    """
+    return multi_new( names, data ).intdigests()
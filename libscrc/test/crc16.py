@@ -9,7 +9,16 @@
 # History:  2017-08-17 Wheel Ver:0.0.3 [Heyn] Initialize
 #           2019-04-22 Wheel Ver:1.1   [Heyn] New add some functions.
 #           2020-04-28 Wheel Ver:1.3   [Heyn] Optimized code.
-
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add t10_dif_blocks and PCLMULQDQ folding test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add records test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add multi-buffer lanes test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add fletcher16 combine test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add network sum / combine / update test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add fletcher16 blocks test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] fletcher16 combine range test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] network combine range test.
+
+import struct
 import unittest
 
 import libscrc
@@ -106,6 +115,131 @@ class TestCRC16( unittest.TestCase ):
         """
         self.do_basics( _crc16 )
 
+    def test_folding( self ):
+        """ Lengths around the 64 byte folds, against a bit by bit CRC.
+        """
+        def bitwise( data, poly, reflected ):
+            crc = 0
+            for byte in data:
+                if reflected:
+                    crc ^= byte
+                    for _ in range( 8 ):
+                        crc = ( crc >> 1 ) ^ poly if crc & 1 else crc >> 1
+                else:
+                    crc ^= byte << 8
+                    for _ in range( 8 ):
+                        crc = ( ( crc << 1 ) ^ poly ) & 0xFFFF if crc & 0x8000 else crc << 1
+            return crc
+
+        for n in ( 63, 64, 65, 79, 128, 191, 255, 256, 257 ):
+            data = bytes( ( i * 7 + 3 ) & 0xFF for i in range( n ) )
+            self.assertEqual( _crc16.t10_dif( data ), bitwise( data, 0x8BB7, False ) )
+            self.assertEqual( _crc16.kermit( data ),  bitwise( data, 0x8408, True ) )
+
+    def test_t10_dif_blocks( self ):
+        """ One guard per sector, as array('H') or big-endian into a buffer.
+        """
+        data = bytes( range( 256 ) ) * 64
+        for size in ( 512, 4096 ):
+            guards = _crc16.t10_dif_blocks( data, size )
+            self.assertEqual( list( guards ), [ _crc16.t10_dif( data[i:i + size] ) for i in range( 0, len( data ), size ) ] )
+
+        guards = _crc16.t10_dif_blocks( data )
+        out    = bytearray( 2 * len( guards ) )
+        self.assertEqual( _crc16.t10_dif_blocks( data, out=out ), len( guards ) )
+        self.assertEqual( out, b''.join( guard.to_bytes( 2, 'big' ) for guard in guards ) )
+
+        self.assertRaises( ValueError, _crc16.t10_dif_blocks, data[:-1] )
+        self.assertRaises( ValueError, _crc16.t10_dif_blocks, b'', 2**32 )
+        self.assertRaises( ValueError, _crc16.t10_dif_blocks, data, out=bytearray( 2 ) )
+        self.assertRaises( BufferError, _crc16.t10_dif_blocks, data, out=bytes( 64 ) )
+
+    def test_records( self ):
+        """ One CRC per record, Modbus frames carry theirs little-endian at the end.
+        """
+        frames = [ bytes( [ i % 248, 3, 0, i % 256, 0, 10 ] ) for i in range( 1000 ) ]
+        data   = b''.join( f + _crc16.modbus( f ).to_bytes( 2, 'little' ) for f in frames )
+        crcs   = libscrc.records( 'modbus', data, 8, length=6 )
+        self.assertEqual( crcs.typecode, 'H' )
+        self.assertEqual( crcs.tolist(), [ _crc16.modbus( f ) for f in frames ] )
+        self.assertEqual( libscrc.records( 'modbus', data, 8 ).tolist(), [ 0 ] * 1000 )
+        self.assertEqual( libscrc.records( 'modbus', data, 8, length=6, check=6, byteorder='little' ).tolist(), [] )
+        self.assertEqual( libscrc.records( 'modbus', data[:8] + bytes( 8 ), 8, length=6, check=6, byteorder='little' ).tolist(), [ 1 ] )
+        self.assertRaises( ValueError, libscrc.records, 'modbus', data, 8, byteorder='middle' )
+
+    def test_lanes( self ):
+        """ Batches of short messages of mixed length, reflected and MSB-first.
+        """
+        buffers = [ bytes( range( i % 251 ) )[( i * 7 ) % 5:] for i in range( 700 ) ]
+        self.assertEqual( libscrc.modbus_many( buffers ).tolist(), [ _crc16.modbus( b ) for b in buffers ] )
+        data = bytes( range( 256 ) ) * 39
+        for name in ( 'modbus', 'xmodem', 'dnp', 'cdma2000' ):
+            function = getattr( _crc16, name )
+            for size in ( 3, 8, 13, 100 ):
+                crcs = libscrc.records( name, data[:len( data ) // size * size], size )
+                self.assertEqual( crcs.tolist(), [ function( data[i:i + size] ) for i in range( 0, len( data ) // size * size, size ) ] )
+
+    def test_fletcher16_combine( self ):
+        """ Fletcher-16 of two pieces merged equals the one of the whole buffer.
+        """
+        data = bytes( range( 256 ) ) * 7 + b'\xFF' * 300
+        for split in ( 0, 1, 254, 255, 1000, len( data ) ):
+            a, b = data[:split], data[split:]
+            self.assertEqual( _crc16.fletcher16_combine( _crc16.fletcher16( a ), _crc16.fletcher16( b ), len( b ) ), _crc16.fletcher16( data ) )
+        self.assertRaises( ValueError,    _crc16.fletcher16_combine, 1 << 16, 0, 0 )
+        self.assertRaises( ValueError,    _crc16.fletcher16_combine, 0, -1, 0 )
+        self.assertRaises( ValueError,    _crc16.fletcher16_combine, 0, 0, -1 )
+        self.assertRaises( OverflowError, _crc16.fletcher16_combine, 0, 0, 2**64 )
+
+    def test_fletcher16( self ):
+        """ Fletcher-16 around the vector blocks and the deferred modulo, against the byte by byte one.
+        """
+        def reference( data ):
+            sum1 = sum2 = 0
+            for byte in bytearray( data ):
+                sum1 = ( sum1 + byte ) % 255
+                sum2 = ( sum2 + sum1 ) % 255
+            return sum1 | ( sum2 << 8 )
+
+        data = bytes( range( 256 ) ) * 50 + b'\xFF' * 12000
+        for size in ( 0, 1, 63, 64, 65, 5760, 5802, 5803, 11605, len( data ) ):
+            self.assertEqual( _crc16.fletcher16( data[:size] ), reference( data[:size] ) )
+            self.assertEqual( _crc16.fletcher16( data[3:size] ), reference( data[3:size] ) )
+
+    def test_network( self ):
+        """ Internet checksum around the vector blocks, partial sums at odd / even offsets and RFC 1624 updates.
+        """
+        def reference( data ):
+            total = sum( struct.unpack( '<%dH' % ( len( data ) // 2 ), data[:len( data ) // 2 * 2] ) )
+            total += data[-1] if len( data ) % 2 else 0
+            while total >> 16:
+                total = ( total >> 16 ) + ( total & 0xFFFF )
+            return total
+
+        data = bytes( range( 256 ) ) * 600 + b'\xFF' * 70001
+        for size in ( 0, 1, 7, 8, 63, 64, 65, 130, 1001, 153600, len( data ) ):
+            self.assertEqual( _crc16.network_sum( data[:size] ), reference( data[:size] ) )
+            self.assertEqual( _crc16.tcp( data[3:size] ), ~reference( data[3:size] ) & 0xFFFF )
+
+        for split in ( 0, 1, 2, 77, 1000, len( data ) ):
+            a, b = data[:split], data[split:]
+            self.assertEqual( _crc16.network_combine( _crc16.network_sum( a ), _crc16.network_sum( b ), len( a ) ),
+                              _crc16.network_sum( data ) )
+            if split % 2 == 0:
+                self.assertEqual( _crc16.network_sum( b, _crc16.network_sum( a ) ), _crc16.network_sum( data ) )
+
+        # RFC 1624 section 4, HC = 0xDD2F, m = 0x5555, m' = 0x3285 gives HC' = 0x0000.
+        self.assertEqual( _crc16.network_update( 0xDD2F, 0x5555, 0x3285 ), 0x0000 )
+        header = bytearray( b'\x45\x00\x00\x3c\x1c\x46\x40\x00\x40\x06\x00\x00\xac\x10\x0a\x63\xac\x10\x0a\x0c' )
+        check  = _crc16.tcp( bytes( header ) )
+        old    = _crc16.network_sum( bytes( header[8:10] ) )
+        header[8] -= 1
+        self.assertEqual( _crc16.network_update( check, old, _crc16.network_sum( bytes( header[8:10] ) ) ), _crc16.tcp( bytes( header ) ) )
+        self.assertRaises( ValueError,    _crc16.network_update, 1 << 16, 0, 0 )
+        self.assertRaises( ValueError,    _crc16.network_combine, 1 << 16, 0, 0 )
+        self.assertRaises( ValueError,    _crc16.network_combine, 0, 0, -1 )
+        self.assertRaises( OverflowError, _crc16.network_combine, 0, 0, 2**64 )
+
 
 if __name__ == '__main__':
     unittest.main()
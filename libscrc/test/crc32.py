@@ -8,8 +8,19 @@
 # Package:  pip install libscrc.
 # History:  2020-03-13 Wheel Ver:0.1.6 [Heyn] Initialize
 #           2020-04-26 Wheel Ver:1.3   [Heyn] Optimized Code
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add threads=N test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add zero runs test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add records test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add adler32 test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add adler32 / fletcher32 combine test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add fletcher32 blocks test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] threads keyword only test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] adler32 / fletcher32 combine range test.
 
+import zlib
+import struct
 import unittest
+import threading
 
 import libscrc
 from libscrc import _crc32
@@ -74,6 +85,173 @@ class TestCRC32( unittest.TestCase ):
         """
         self.do_basics( _crc32 )
 
+    def test_slicing( self ):
+        """ Test every tail length of the slicing-by-8 loop.
+        """
+        data = bytes( bytearray( range( 256 ) ) ) * 17
+        for i in range( 0, 24 ):
+            self.assertEqual( _crc32.crc32( data[i:] ), zlib.crc32( data[i:] ) & 0xFFFFFFFF )
+
+    def test_folding( self ):
+        """ Test the PCLMULQDQ folding engine (reflected and MSB-first, full and short widths).
+        """
+        data = bytes( bytearray( range( 256 ) ) ) * 64
+        self.assertEqual( _crc32.mpeg2( data ),         0x2BDE5F51 )
+        self.assertEqual( _crc32.bzip2( data ),         0xD421A0AE )
+        self.assertEqual( _crc32.posix( data ),         0x4A957584 )
+        self.assertEqual( _crc32.crc32_c( data ),       0xE92C0DAE )
+        self.assertEqual( _crc32.crc32_q( data ),       0xFDAE2F80 )
+        self.assertEqual( _crc32.xfer( data ),          0xEE51A187 )
+        self.assertEqual( _crc32.autosar( data ),       0x36B5CCC8 )
+        self.assertEqual( _crc32.cdma( data ),          0x09EDF758 )
+        self.assertEqual( _crc32.philips( data ),       0x5959394F )
+        self.assertEqual( _crc32.mpeg2( data[:1000] ),  0xA7D7BA6B )
+        self.assertEqual( _crc32.crc32_c( data[:1000] ),0x1A318E30 )
+        self.assertEqual( _crc32.cdma( data[:1000] ),   0x106055AE )
+        self.assertEqual( _crc32.philips( data[:1000] ),0x00600F64 )
+
+    def test_sse42( self ):
+        """ Test CRC32-C across the long, short and unaligned streams.
+        """
+        data = bytes( range( 256 ) ) * 160
+        self.assertEqual( _crc32.crc32_c( data ),       0x8DF438C5 )
+        self.assertEqual( _crc32.crc32_c( data[1:] ),   0x222C42A4 )
+        self.assertEqual( _crc32.iscsi( data[:24581] ), 0x916007EC )
+        self.assertEqual( _crc32.base91_c( data[7:800] ),0x315FF0BE )
+        self.assertEqual( _crc32.crc32_c( data[3:9] ),  0x04B1F536 )
+        self.assertEqual( libscrc.hacker32( data, poly=0x1EDC6F41, init=0xFFFFFFFF, xorout=0xFFFFFFFF, refin=True, refout=True ), 0x8DF438C5 )
+
+    def test_gil_threshold( self ):
+        """ Test threads computing with the GIL released.
+        """
+        data    = bytes( range( 256 ) ) * 64
+        expect  = [ _crc32.crc32( data ), _crc32.mpeg2( data ), libscrc.hacker32( data, poly=0x814141AB ) ]
+        results = []
+
+        def worker():
+            results.append( [ _crc32.crc32( data ), _crc32.mpeg2( data ), libscrc.hacker32( data, poly=0x814141AB ) ] )
+
+        previous = libscrc.gil_threshold( 0 )
+        try:
+            threads = [ threading.Thread( target=worker ) for _ in range( 4 ) ]
+            for thread in threads:
+                thread.start()
+            for thread in threads:
+                thread.join()
+        finally:
+            libscrc.gil_threshold( previous )
+
+        self.assertEqual( results, [ expect ] * 4 )
+        self.assertEqual( libscrc.gil_threshold(), previous )
+        self.assertRaises( ValueError, libscrc.gil_threshold, -1 )
+
+    def test_threads( self ):
+        """ Test threads=N against the single threaded result.
+        """
+        data = bytes( range( 256 ) ) * 12345
+        for function in ( _crc32.crc32, _crc32.mpeg2, _crc32.crc32_c, libscrc.modbus, libscrc.xz64, libscrc.umts12 ):
+            self.assertEqual( function( data, threads=4 ), function( data ) )
+            self.assertEqual( function( data[:100], threads=4 ), function( data[:100] ) )
+        self.assertEqual( _crc32.crc32( data, threads=4 ), zlib.crc32( data ) )
+        self.assertEqual( _crc32.crc32( data, threads=0 ), zlib.crc32( data ) )
+        self.assertEqual( _crc32.crc32( data, threads=2**40 ), zlib.crc32( data ) )
+        self.assertRaises( ValueError, _crc32.crc32, data, threads=-1 )
+        self.assertRaises( TypeError,  _crc32.crc32, data, 4 )
+        self.assertRaises( TypeError,  _crc32.adler32, data, 1, 4 )
+        self.assertRaises( TypeError,  libscrc.records, 'crc32', data, 64, 0, 60, None, 'big', 2 )
+
+    def test_zero_runs( self ):
+        """ Test buffers with long runs of zero bytes.
+        """
+        for data in ( bytes( 0x20000 ), b'1' + bytes( 0x10040 ) + b'2', bytes( range( 256 ) ) + bytes( 0x12345 ) + bytes( range( 77 ) ) ):
+            self.assertEqual( _crc32.crc32( data ), zlib.crc32( data ) )
+            self.assertEqual( libscrc.hacker32( data, poly=0x04C11DB7, init=0xFFFFFFFF, xorout=0xFFFFFFFF ), zlib.crc32( data ) )
+
+    def test_records( self ):
+        """ Test one CRC per fixed-size record, and verifying a stored CRC field.
+        """
+        payloads = [ bytes( range( i % 256 ) )[:60].ljust( 60, b'x' ) for i in range( 500 ) ]
+        data     = b''.join( p + zlib.crc32( p ).to_bytes( 4, 'little' ) for p in payloads )
+        crcs     = libscrc.records( 'crc32', data, 64, length=60 )
+        self.assertEqual( crcs.typecode, 'I' )
+        self.assertEqual( crcs.tolist(), [ zlib.crc32( p ) for p in payloads ] )
+        self.assertEqual( libscrc.records( 'crc32_c', data, 64, 4, 8 ).tolist(), [ _crc32.crc32_c( p[4:12] ) for p in payloads ] )
+        self.assertEqual( libscrc.records( 'crc32', data, 64, length=60, check=60, byteorder='little', threads=2 ).tolist(), [] )
+
+        broken = bytearray( data )
+        for index in ( 3, 499 ):
+            broken[index * 64 + 10] ^= 0x01
+        self.assertEqual( libscrc.records( 'crc32', broken, 64, length=60, check=60, byteorder='little' ).tolist(), [ 3, 499 ] )
+        self.assertEqual( len( libscrc.records( 'crc32', data, 64, length=60, check=60 ) ), 500 )
+
+        self.assertRaises( ValueError, libscrc.records, 'crc32', data[:-1], 64 )
+        self.assertRaises( ValueError, libscrc.records, 'crc32', data, 64, 8, 60 )
+        self.assertRaises( ValueError, libscrc.records, 'crc32', data, 64, check=61 )
+        self.assertRaises( ValueError, libscrc.records, 'xz64', data, 64 )
+
+    def test_adler32( self ):
+        """ Test Adler-32 against zlib around the vector blocks and the NMAX reduction, and streaming.
+        """
+        data = bytes( bytearray( range( 256 ) ) ) * 300
+        ones = b'\xFF' * 70000
+        for size in ( 0, 1, 31, 32, 63, 64, 65, 5503, 5504, 5552, 5553, 11200, len( data ) ):
+            self.assertEqual( _crc32.adler32( data[:size] ), zlib.adler32( data[:size] ) )
+            self.assertEqual( _crc32.adler32( data[3:size] ), zlib.adler32( data[3:size] ) )
+            self.assertEqual( _crc32.adler32( ones[:size] ), zlib.adler32( ones[:size] ) )
+        self.assertEqual( _crc32.adler32( ones ), zlib.adler32( ones ) )
+
+        adler = 1
+        for i in range( 0, len( data ), 1000 ):
+            adler = _crc32.adler32( data[i:i + 1000], adler )
+        self.assertEqual( adler, zlib.adler32( data ) )
+        self.assertEqual( _crc32.adler32( data, 0xFFF0FFF0 ), zlib.adler32( data, 0xFFF0FFF0 ) )
+
+    def test_combine( self ):
+        """ Test adler32_combine / fletcher32_combine against the checksum of the joined buffer, and threads=N.
+        """
+        data = bytes( bytearray( range( 256 ) ) ) * 40 + b'\xFF' * 6000
+        for split in ( 0, 1, 2, 255, 4096, 10239, 10240, len( data ) - 1, len( data ) ):
+            a, b = data[:split], data[split:]
+            self.assertEqual( _crc32.adler32_combine( zlib.adler32( a ), zlib.adler32( b ), len( b ) ), zlib.adler32( data ) )
+            if split % 2 == 0:
+                self.assertEqual( _crc32.fletcher32_combine( _crc32.fletcher32( a ), _crc32.fletcher32( b ), len( b ) ),
+                                  _crc32.fletcher32( data ) )
+        self.assertRaises( ValueError,    _crc32.adler32_combine, 1 << 32, 1, 0 )
+        self.assertRaises( ValueError,    _crc32.adler32_combine, -1, 1, 0 )
+        self.assertRaises( ValueError,    _crc32.adler32_combine, 1, 1, -1 )
+        self.assertRaises( OverflowError, _crc32.adler32_combine, 1, 1, 2**64 )
+        self.assertRaises( ValueError,    _crc32.fletcher32_combine, 0, 1 << 32, 0 )
+        self.assertRaises( ValueError,    _crc32.fletcher32_combine, 0, 0, -2 )
+        self.assertRaises( OverflowError, _crc32.fletcher32_combine, 0, 0, 2**64 )
+
+        data = bytes( bytearray( range( 251 ) ) ) * 12000 + b'\xFF' * 999
+        for threads in ( 0, 2, 3, 4 ):
+            self.assertEqual( _crc32.adler32( data, threads=threads ), zlib.adler32( data ) )
+            self.assertEqual( _crc32.fletcher32( data, threads=threads ), _crc32.fletcher32( data ) )
+        self.assertEqual( _crc32.adler32( data, 0xFFF0FFF0, threads=4 ), zlib.adler32( data, 0xFFF0FFF0 ) )
+
+    def test_fletcher32( self ):
+        """ Fletcher-32 around the vector blocks and the deferred modulo, against the word by word fold.
+        """
+        def reference( data ):
+            words = list( struct.unpack( '<%dH' % ( len( data ) // 2 ), data[:len( data ) // 2 * 2] ) )
+            sum1 = sum2 = 0xFFFF
+            for word in words + ( [ data[-1] ] if len( data ) % 2 else [] ):
+                sum1 += word
+                sum2 += sum1
+                sum1 = ( sum1 & 0xFFFF ) + ( sum1 >> 16 )
+                sum2 = ( sum2 & 0xFFFF ) + ( sum2 >> 16 )
+            return ( sum1 | ( sum2 << 16 ) ) & 0xFFFFFFFF
+
+        data = bytes( bytearray( range( 256 ) ) ) * 80 + b'\xFF' * 9000 + bytes( 300 )
+        for size in ( 0, 1, 2, 63, 64, 65, 719, 720, 722, 8191, 8192, 8257, 20479, len( data ) ):
+            self.assertEqual( _crc32.fletcher32( data[:size] ), reference( data[:size] ) )
+            self.assertEqual( _crc32.fletcher32( data[1:size] ), reference( data[1:size] ) )
+        self.assertEqual( _crc32.fletcher32( b'\xFF' * 70000 ), reference( b'\xFF' * 70000 ) )
+        # sum2 folds to 0x10000 here, the high half has always come out as 0.
+        self.assertEqual( _crc32.fletcher32( b'\x01' ), 0x00000001 )
+        self.assertEqual( _crc32.fletcher32( data * 100 + b'\x01', threads=4 ), reference( data * 100 + b'\x01' ) )
+
 
 if __name__ == '__main__':
     unittest.main()
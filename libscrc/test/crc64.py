@@ -9,6 +9,9 @@
 # History:  2017-08-19 Wheel Ver:0.0.5 [Heyn] Initialize
 #           2020-03-16 Wheel Ver:0.1.6 [Heyn] New add libscrc.hacker64()
 #           2020-04-23 Wheel Ver:1.1   [Heyn] Bug fixed.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add slicing-by-8 test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add PCLMULQDQ folding test.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add CRC-64/NVME test.
 
 import unittest
 import libscrc
@@ -32,6 +35,7 @@ class TestCRC64( unittest.TestCase ):
 
         self.assertEqual( module.we(b'123456789'),      0x62EC59E3F1A4F00A )
         self.assertEqual( module.xz64(b'123456789'),    0x995DC9BBDF1939FA )
+        self.assertEqual( module.nvme64(b'123456789'),  0xAE8B14860A799888 )
 
         self.assertEqual( module.hacker64(b'123456789', poly=0x42F0E1EBA9EA3693, init=0, xorout=0, refin=False, refout=False), 0x6C40DF5F0B497347 )
 
@@ -53,6 +57,41 @@ class TestCRC64( unittest.TestCase ):
         self.assertEqual( _crc64.iso(b'A' * 16 * 1024 * 1024),     0x799F69518B336624 )
         self.assertEqual( _crc64.ecma182(b'A' * 16 * 1024 * 1024), 0xF8A0D6AC4D42F9A6 )
 
+    def test_nvme64_blocks( self ):
+        """ One guard per logical block.
+        """
+        data = bytes( range( 256 ) ) * 64
+        for size in ( 512, 4096 ):
+            guards = _crc64.nvme64_blocks( data, block_size=size )
+            self.assertEqual( list( guards ), [ _crc64.nvme64( data[i:i + size] ) for i in range( 0, len( data ), size ) ] )
+        self.assertEqual( list( _crc64.nvme64_blocks( b'' ) ), [] )
+        self.assertRaises( ValueError, _crc64.nvme64_blocks, data[:-1] )
+        self.assertRaises( ValueError, _crc64.nvme64_blocks, data, 0 )
+        self.assertRaises( ValueError, _crc64.nvme64_blocks, b'', 2**32 )
+
+    def test_slicing( self ):
+        """ Every length around the 8 byte slices and the 64 byte folds, against a bit by bit CRC.
+        """
+        def bitwise( data, poly, init, xorout, reflected ):
+            crc = init
+            for byte in data:
+                if reflected:
+                    crc ^= byte
+                    for _ in range( 8 ):
+                        crc = ( crc >> 1 ) ^ poly if crc & 1 else crc >> 1
+                else:
+                    crc ^= byte << 56
+                    for _ in range( 8 ):
+                        crc = ( ( crc << 1 ) ^ poly ) & 0xFFFFFFFFFFFFFFFF if crc >> 63 else crc << 1
+            return crc ^ xorout
+
+        for n in list( range( 40 ) ) + [ 64, 79, 128, 191, 255, 256, 257 ]:
+            data = bytes( ( i * 7 + 3 ) & 0xFF for i in range( n ) )
+            self.assertEqual( _crc64.xz64( data ),    bitwise( data, 0xC96C5795D7870F42, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, True ) )
+            self.assertEqual( _crc64.ecma182( data ), bitwise( data, 0x42F0E1EBA9EA3693, 0, 0, False ) )
+            self.assertEqual( _crc64.hacker64( data, poly=0x000000000000001B, init=0, xorout=0, refin=False, refout=False ),
+                              bitwise( data, 0x000000000000001B, 0, 0, False ) )
+
 
 if __name__ == '__main__':
     unittest.main()
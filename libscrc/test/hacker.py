@@ -8,6 +8,10 @@
 # Package:  pip install libscrc.
 # History:  2020-03-16 Wheel Ver:0.1.6 [Heyn] Initialize
 #           2020-04-30 Wheel Ver:1.3   [Heyn] Optimized code
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add table cache test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add combine test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add arguments test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] threads keyword only test
 
 import unittest
 
@@ -47,6 +51,56 @@ class TestHacker( unittest.TestCase ):
         self.do_basics_16( _crc16 )
         self.do_basics_32( _crc32 )
 
+    def test_cache( self ):
+        """ Test the hacker table cache.
+        """
+        libscrc.hacker_cache_clear()
+        for _ in range( 3 ):
+            self.do_basics_32( libscrc )
+        info = libscrc.hacker_cache_info()['hacker32']
+        self.assertEqual( ( info.hits, info.misses, info.currsize ), ( 7, 2, 2 ) )
+
+        # More models than entries, the least recently used are replaced.
+        for poly in range( 1, 2 * info.maxsize + 1 ):
+            self.assertEqual( libscrc.hacker16( b'123456789', poly=poly ), libscrc.hacker16( b'123456789', poly=poly ) )
+        self.assertEqual( libscrc.hacker_cache_info()['hacker16'].currsize, info.maxsize )
+        self.do_basics_16( libscrc )
+
+        libscrc.hacker_cache_clear()
+        self.assertEqual( libscrc.hacker_cache_info()['hacker32'], ( 0, 0, info.maxsize, 0 ) )
+        self.assertFalse( hasattr( libscrc, 'namedtuple' ) )
+
+    def test_combine( self ):
+        """ Test combine with hacker parameters.
+        """
+        a, b = b'123456789', bytes( range( 256 ) ) * 3
+        for params in ( {}, { 'init' : 0x12 }, { 'poly' : 0x1D, 'init' : 0x5A, 'xorout' : 0x33, 'refin' : True, 'refout' : True } ):
+            for name in ( 'hacker8', 'hacker16', 'hacker24', 'hacker32', 'hacker64' ):
+                function = getattr( libscrc, name )
+                crc = libscrc.combine( name, function( a, **params ), function( b, **params ), len( b ), **params )
+                self.assertEqual( crc, function( a + b, **params ), name )
+
+    def test_arguments( self ):
+        """ Positional / keyword arguments and buffer types of the catalogue and hacker functions.
+        """
+        data = b'123456789'
+        for source in ( data, bytearray( data ), memoryview( data ) ):
+            self.assertEqual( libscrc.hacker16( source, 0x1021, 0x0000, 0x0000, False, False ), 0x31C3 )
+            self.assertEqual( libscrc.hacker16( source, refout=False, poly=0x1021, init=0, refin=0 ), 0x31C3 )
+            self.assertEqual( libscrc.hacker32( data=source ), 0xCBF43926 )
+            self.assertEqual( libscrc.modbus( data=source, threads=4 ), 0x4B37 )
+        self.assertEqual( libscrc.hacker8( data, poly=0x107 ), libscrc.hacker8( data, poly=0x07 ) )
+        self.assertEqual( libscrc.intel( data ), libscrc.intel( data, 0 ) )
+        self.assertRaises( TypeError, libscrc.modbus )
+        self.assertRaises( TypeError, libscrc.modbus, '123456789' )
+        self.assertRaises( TypeError, libscrc.modbus, data, 1, 2 )
+        self.assertRaises( TypeError, libscrc.modbus, data, 4 )
+        self.assertRaises( ValueError, libscrc.modbus, data, threads=-1 )
+        self.assertRaises( TypeError, libscrc.modbus, data, thread=1 )
+        self.assertRaises( TypeError, libscrc.modbus, data, data=data )
+        self.assertRaises( TypeError, libscrc.hacker16, data, poly=1.5 )
+        self.assertRaises( TypeError, libscrc.intel, data=data )
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -8,6 +8,7 @@
 # Package:  pip install libscrc.
 # History:  2017-08-17 Wheel Ver:0.0.3 [Heyn] Initialize
 #           2020-04-30 Wheel Ver:1.3   [Heyn] Optimized code, removed two steps compute function
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add modbus_many test
 
 import unittest
 
@@ -52,6 +53,17 @@ class TestCRC16Modbus( unittest.TestCase ):
         """
         self.assertEqual( _crc16.modbus( b'A' * 16 * 1024 * 1024 ), 0x588F )
 
+    def test_many(self):
+        """Test one CRC per buffer, also split over threads.
+        """
+        buffers = [ b'123456789', bytearray( b'A' * 4096 ), memoryview( b'' ) ] * 1000
+        values  = [ 0x4B37, 0x4444, 0xFFFF ] * 1000
+        self.assertEqual( libscrc.modbus_many( buffers ).typecode, 'H' )
+        self.assertEqual( libscrc.modbus_many( buffers ).tolist(), values )
+        self.assertEqual( libscrc.modbus_many( iter( buffers ), threads=3 ).tolist(), values )
+        self.assertEqual( libscrc.modbus_many( [] ).tolist(), [] )
+        self.assertRaises( TypeError, libscrc.modbus_many, [ b'1', 1 ] )
+
 
 if __name__ == '__main__':
     unittest.main()
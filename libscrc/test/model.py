@@ -0,0 +1,202 @@
+# -*- coding:utf-8 -*-
+""" Test library for CRC model """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Author:   Heyn (heyunhuan@gmail.com)
+# Program:  Test library Model.
+# Package:  pip install libscrc.
+# History:  2026-10-17 Wheel Ver:1.3   [Heyn] Initialize
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add streaming test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add combine test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add threads test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add extend_zeros test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add many test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add multi test
+#           2026-10-17 Wheel Ver:1.3   [Heyn] threads keyword only, threads=0 one per CPU
+#           2026-10-17 Wheel Ver:1.3   [Heyn] combine / extend_zeros length range test
+
+import unittest
+import threading
+
+import libscrc
+from libscrc import _model
+
+class TestModel( unittest.TestCase ):
+    """ Test Model variant.
+    """
+
+    def do_basics( self, module ):
+        """ Check values from the CRC catalogue, width 3 to 64.
+        """
+        self.assertEqual( module.Model( 3,  0x3,  0x7,  0x0,  True,  True  )( b'123456789' ), 0x6 )
+        self.assertEqual( module.Model( 7,  0x09, 0x00, 0x00, False, False )( b'123456789' ), 0x75 )
+        self.assertEqual( module.Model( 12, 0x80F, 0x000, 0x000, False, True )( b'123456789' ), 0xDAF )
+        self.assertEqual( module.Model( 16, 0x8005, 0xFFFF, 0x0000, True, True )( b'123456789' ), 0x4B37 )
+        self.assertEqual( module.Model( 24, 0x864CFB, 0xB704CE, 0x000000 )( b'123456789' ), 0x21CF02 )
+        self.assertEqual( module.Model( 32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, True, True )( b'123456789' ), 0xCBF43926 )
+        self.assertEqual( module.Model( 32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, True, True )( b'123456789' ), 0xE3069283 )
+        self.assertEqual( module.Model( 40, 0x0004820009, 0, 0xFFFFFFFFFF )( b'123456789' ), 0xD4164FC646 )
+        self.assertEqual( module.Model( 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, True, True )( b'123456789' ), 0x995DC9BBDF1939FA )
+
+    def test_basics( self ):
+        """ Test basic functionality.
+        """
+        self.do_basics( libscrc )
+
+    def test_basics_c( self ):
+        """ Test basic functionality of the extension module.
+        """
+        self.do_basics( _model )
+
+    def test_catalogue( self ):
+        """ Same result as the catalogue functions on long buffers.
+        """
+        data = bytes( range( 256 ) ) * 64
+        self.assertEqual( libscrc.Model( 16, 0x8005, 0xFFFF, 0x0000, True, True )( data ), libscrc.modbus( data ) )
+        self.assertEqual( libscrc.Model( 30, 0x2030B9C7, 0x3FFFFFFF, 0x3FFFFFFF )( data ), libscrc.cdma( data ) )
+        self.assertEqual( libscrc.Model( 32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, True, True )( memoryview( data ) ), libscrc.crc32( data ) )
+        self.assertEqual( libscrc.Model( 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, True, True )( data ), libscrc.xz64( data ) )
+
+    def test_arguments( self ):
+        """ Test parameters and call arguments.
+        """
+        model = libscrc.Model( width=16, poly=0x1021, init=0xFFFF, refin=False, refout=False )
+        self.assertEqual( ( model.width, model.poly, model.init, model.xorout, model.refin, model.refout ),
+                          ( 16, 0x1021, 0xFFFF, 0x0000, False, False ) )
+        self.assertEqual( repr( model ), 'Model(width=16, poly=0x1021, init=0xFFFF, xorout=0x0000, refin=False, refout=False)' )
+        self.assertRaises( ValueError, libscrc.Model, 2,  0x3 )
+        self.assertRaises( ValueError, libscrc.Model, 65, 0x3 )
+        self.assertRaises( ValueError, libscrc.Model, 8,  0x107 )
+        self.assertRaises( TypeError,  model )
+        self.assertRaises( TypeError,  model, b'1', b'2' )
+        self.assertRaises( TypeError,  model, data=b'1' )
+        self.assertRaises( TypeError,  model, u'123' )
+
+    def test_hasher( self ):
+        """ Test streaming, every catalogue function gives the same result in pieces.
+        """
+        data = bytes( range( 256 ) ) * 40
+        for name in libscrc.algorithms_available:
+            crc = libscrc.new( name )
+            for i in range( 0, len( data ), 1000 ):
+                crc.update( data[i:i + 1000] )
+            self.assertEqual( crc.intdigest(), getattr( libscrc, name )( data ), name )
+
+        crc = libscrc.new( 'modbus', b'1234' )
+        branch = crc.copy()
+        crc.update( b'56789' )
+        branch.update( memoryview( b'5' ) )
+        self.assertEqual( crc.intdigest(), 0x4B37 )
+        self.assertEqual( crc.digest(), b'\x4B\x37' )
+        self.assertEqual( crc.hexdigest(), '4b37' )
+        self.assertEqual( crc.digest_size, 2 )
+        self.assertEqual( branch.intdigest(), libscrc.modbus( b'12345' ) )
+        self.assertEqual( libscrc.Model( 12, 0x80F, refout=True ).new( b'123456789' ).hexdigest(), '0daf' )
+        self.assertRaises( ValueError, libscrc.new, 'md5' )
+
+    def test_hasher_threads( self ):
+        """ Updates from several threads are serialized.
+        """
+        data  = bytes( range( 256 ) ) * 64
+        crc   = libscrc.new( 'crc32' )
+        tasks = [ threading.Thread( target=crc.update, args=( data, ) ) for _ in range( 4 ) ]
+        for task in tasks:
+            task.start()
+        for task in tasks:
+            task.join()
+        self.assertEqual( crc.intdigest(), libscrc.crc32( data * 4 ) )
+
+    def test_combine( self ):
+        """ Test combine, CRC(A) and CRC(B) to CRC(AB).
+        """
+        a, b = b'1234', bytes( range( 256 ) ) * 9
+        for name in libscrc.algorithms_available:
+            function = getattr( libscrc, name )
+            self.assertEqual( libscrc.combine( name, function( a ), function( b ), len( b ) ), function( a + b ), name )
+            self.assertEqual( libscrc.combine( name, function( a ), function( b'' ), 0 ), function( a ), name )
+
+        model = libscrc.Model( 5, 0x05, 0x1F, 0x1F, True, False )
+        self.assertEqual( model.combine( model( b ), model( a ), len( a ) ), model( b + a ) )
+        self.assertRaises( ValueError, model.combine, 0x20, 0, 1 )
+        self.assertRaises( ValueError,    model.combine, 1, 2, -1 )
+        self.assertRaises( OverflowError, model.combine, 1, 2, 2**64 )
+        self.assertRaises( ValueError,    model.combine, -1, 2, 1 )
+        self.assertRaises( ValueError, libscrc.combine, 'md5', 0, 0, 1 )
+        self.assertRaises( TypeError,  libscrc.combine, 'modbus', 0, 0, 1, poly=0x8005 )
+
+    def test_threads( self ):
+        """ Same result with the buffer split over threads.
+        """
+        data  = bytes( range( 256 ) ) * 12345
+        crc12 = libscrc.Model( 12, 0x80F, 0x000, 0x000, False, True )
+        for model in ( crc12, libscrc.Model( 64, 0x42F0E1EBA9EA3693, 0, 0, True, True ) ):
+            self.assertEqual( model( data, threads=3 ), model( data ) )
+            self.assertEqual( model( data, threads=0 ), model( data ) )
+            self.assertEqual( model.many( [ data, data[:100] ], threads=0 ).tolist(), [ model( data ), model( data[:100] ) ] )
+        self.assertRaises( ValueError, crc12, data, threads=-1 )
+        self.assertRaises( TypeError,  crc12, data, 3 )
+        self.assertRaises( TypeError,  crc12.many, [ data ], 3 )
+        self.assertRaises( TypeError,  crc12, data, thread=2 )
+
+    def test_extend_zeros( self ):
+        """ Same result as computing the zero bytes.
+        """
+        data = b'123456789'
+        for model in ( libscrc.Model( 12, 0x80F, 0x000, 0x000, False, True ),
+                       libscrc.Model( 16, 0x8005, 0xFFFF, 0x0000, True, True ),
+                       libscrc.Model( 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, True, True ) ):
+            for n in ( 0, 1, 7, 1000 ):
+                self.assertEqual( model.extend_zeros( model( data ), n ), model( data + bytes( n ) ) )
+        self.assertEqual( libscrc.extend_zeros( 'crc32', libscrc.crc32( data ), 100 ), libscrc.crc32( data + bytes( 100 ) ) )
+        self.assertEqual( libscrc.extend_zeros( 'hacker16', 0x1234, 5, poly=0x1021 ), libscrc.combine( 'hacker16', 0x1234, libscrc.hacker16( bytes( 5 ), poly=0x1021 ), 5, poly=0x1021 ) )
+        self.assertRaises( ValueError, libscrc.Model( 12, 0x80F ).extend_zeros, 0x1000, 1 )
+        self.assertRaises( ValueError,    libscrc.Model( 12, 0x80F ).extend_zeros, 0x100, -1 )
+        self.assertRaises( OverflowError, libscrc.Model( 12, 0x80F ).extend_zeros, 0x100, 2**64 )
+
+    def test_zero_runs( self ):
+        """ Long zero runs are skipped, not computed.
+        """
+        data  = b'123456789' + bytes( 0x30000 ) + b'abc' + bytes( 0x10001 )
+        crc12 = libscrc.Model( 12, 0x80F, 0x000, 0x000, False, True )
+        crc40 = libscrc.Model( 40, 0x0004820009, 0, 0xFFFFFFFFFF )
+        for model in ( crc12, crc40 ):
+            self.assertEqual( model( data ), model.extend_zeros( model( data[:-0x10001] ), 0x10001 ) )
+
+    def test_many( self ):
+        """ One CRC per buffer, the array typecode follows the width.
+        """
+        buffers = [ bytes( range( n % 256 ) ) * 37 for n in range( 3000 ) ]
+        for model, typecode in ( ( libscrc.Model( 8, 0x07 ), 'B' ),
+                                 ( libscrc.Model( 12, 0x80F, 0x000, 0x000, False, True ), 'H' ),
+                                 ( libscrc.Model( 32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, True, True ), 'I' ),
+                                 ( libscrc.Model( 64, 0x42F0E1EBA9EA3693, 0, 0, True, True ), 'Q' ) ):
+            result = model.many( buffers, threads=4 )
+            self.assertEqual( result.typecode, typecode )
+            self.assertEqual( result.tolist(), [ model( data ) for data in buffers ] )
+        self.assertEqual( libscrc.Model( 8, 0x07 ).many( ( b'123456789', ) ).tolist(), [ 0xF4 ] )
+        self.assertRaises( TypeError, libscrc.Model( 8, 0x07 ).many, 1 )
+
+    def test_multi( self ):
+        """ Several algorithms in one pass, same values as one at a time.
+        """
+        names = [ 'crc32', 'crc32_c', 'adler32', 'xz64', 'modbus' ]
+        for data in ( b'', b'123456789', bytes( range( 256 ) ) * 1000, b'\xFF' * 100000 ):
+            self.assertEqual( libscrc.multi( data, names ), dict( ( name, getattr( libscrc, name )( data ) ) for name in names ) )
+
+        data  = bytes( range( 256 ) ) * 1000
+        multi = libscrc.multi_new( names )
+        for i in range( 0, len( data ), 7777 ):
+            multi.update( data[i:i + 7777] )
+        copy = multi.copy()
+        copy.update( b'123456789' )
+        self.assertEqual( multi.names, tuple( names ) )
+        self.assertEqual( multi.intdigests(), libscrc.multi( data, names ) )
+        self.assertEqual( copy.intdigests(), libscrc.multi( data + b'123456789', names ) )
+        self.assertEqual( libscrc.multi_new( [ 'crc32', 'adler32' ], b'123456789' ).hexdigests(), { 'crc32' : 'cbf43926', 'adler32' : '091e01de' } )
+        self.assertRaises( ValueError, libscrc.multi, data, [ 'crc99' ] )
+        self.assertRaises( TypeError, libscrc.Multi, [ ( 'crc32', 1 ) ] )
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,7 +1,9 @@
 # -*- coding:utf-8 -*-
 """ Setup script for CRC8/CRC16/CRC24/CRC32/CRC64 library. """
+import sys
 from os import path
 from setuptools import setup, find_packages, Extension
+from setuptools.command.build_ext import build_ext
 from codecs import open
 
 # !/usr/bin/python
@@ -18,9 +20,26 @@ from codecs import open
 #           2017-09-19 Wheel Ver:0.1.3 [Heyn] New CRC16-X25.
 #           2020-03-17 Wheel Ver:1.0   [Heyn] New hacker16 / hacker32 / hacker64
 #           2020-04-17 Wheel Ver:1.1   [Heyn] Issues #1
+#           2026-10-17 Wheel Ver:1.3   [Heyn] Generate the constant catalogue tables before build_ext.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add _model ( libscrc.Model ).
+#           2026-10-17 Wheel Ver:1.3   [Heyn] Every module sees src/model for the threads=N capsule.
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add src/crc64/_crc64simd.c
+#           2026-10-17 Wheel Ver:1.3   [Heyn] New add src/crc16/_crc16simd.c
 
 here = path.abspath(path.dirname(__file__))
 
+sys.path.insert(0, path.join(here, 'src'))
+import gentables
+
+
+class hexin_build_ext(build_ext):
+    """ Write src/*/_*const.h ( static const catalogue tables ) before compiling. """
+    def run(self):
+        gentables.generate(path.join(here, 'src'))
+        build_ext.run(self)
+
+macros = [('HEXIN_CONST_TABLES', '1')]
+
 with open(path.join(here, 'README.rst'), encoding='utf-8') as f:
     long_description = f.read()
     long_description = long_description.replace("\r", "")
@@ -71,12 +90,18 @@ setup(
 
     include_package_data=True,
 
-    ext_modules=[Extension('libscrc._crcx',  sources=['src/crcx/_crcxmodule.c',   'src/crcx/_crcxtables.c'  ]),
-                 Extension('libscrc._canx',  sources=['src/canx/_canxmodule.c',   'src/canx/_canxtables.c'  ]),
-                 Extension('libscrc._crc8',  sources=['src/crc8/_crc8module.c',   'src/crc8/_crc8tables.c'  ]),
-                 Extension('libscrc._crc16', sources=['src/crc16/_crc16module.c', 'src/crc16/_crc16tables.c']),
-                 Extension('libscrc._crc24', sources=['src/crc24/_crc24module.c', 'src/crc24/_crc24tables.c']),
-                 Extension('libscrc._crc32', sources=['src/crc32/_crc32module.c', 'src/crc32/_crc32tables.c']),
-                 Extension('libscrc._crc64', sources=['src/crc64/_crc64module.c', 'src/crc64/_crc64tables.c']),
+    cmdclass={'build_ext': hexin_build_ext},
+
+    ext_modules=[Extension('libscrc._crcx',  sources=['src/crcx/_crcxmodule.c',   'src/crcx/_crcxtables.c'  ], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._canx',  sources=['src/canx/_canxmodule.c',   'src/canx/_canxtables.c'  ], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._crc8',  sources=['src/crc8/_crc8module.c',   'src/crc8/_crc8tables.c'  ], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._crc16', sources=['src/crc16/_crc16module.c', 'src/crc16/_crc16tables.c', 'src/crc16/_crc16simd.c'], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._crc24', sources=['src/crc24/_crc24module.c', 'src/crc24/_crc24tables.c'], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._crc32', sources=['src/crc32/_crc32module.c', 'src/crc32/_crc32tables.c', 'src/crc32/_crc32simd.c'], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._crc64', sources=['src/crc64/_crc64module.c', 'src/crc64/_crc64tables.c', 'src/crc64/_crc64simd.c'], include_dirs=['src/model'], define_macros=macros),
+                 Extension('libscrc._model', sources=['src/model/_modelmodule.c', 'src/model/_modeltables.c',
+                                                      'src/crc32/_crc32tables.c', 'src/crc32/_crc32simd.c', 'src/crc64/_crc64tables.c',
+                                                      'src/crc64/_crc64simd.c'],
+                           include_dirs=['src/crc32', 'src/crc64', 'src/model'], define_macros=macros),
                 ],
 )
@@ -10,34 +10,64 @@
 * ---------------
 *		New Create at 	2020-04-21 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized Code.
+*                       2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+*                       2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+*                       2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+*                       2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+*                       2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+*                       2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
 *
 *********************************************************************************************************
 */
 
 #include <Python.h>
 #include "_canxtables.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_canx *param )
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_canx *param, unsigned int *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_canx_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned int )value;
+        } else {
+            *result = hexin_canx_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_canx_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_canx_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -45,65 +75,139 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _canx_can15( PyObject *self, PyObject *args )
+static struct _hexin_canx canx_param_can15 = { .is_initial=FALSE,
+                                               .width  = 15,
+                                               .poly   = CAN15_POLYNOMIAL_00004599,
+                                               .init   = 0x00000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00000000L,
+                                               .result = 0 };
+
+static PyObject * _canx_can15( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_canx canx_param_can15 = { .is_initial=FALSE,
-                                                   .width  = 15,
-                                                   .poly   = CAN15_POLYNOMIAL_00004599,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can15 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &canx_param_can15, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", (unsigned short)( canx_param_can15.result & 0x00007FFF ) );
+    return PyLong_FromUnsignedLong( result & 0x00007FFF );
 }
 
-static PyObject * _canx_can17( PyObject *self, PyObject *args )
+static struct _hexin_canx canx_param_can17 = { .is_initial=FALSE,
+                                               .width  = 17,
+                                               .poly   = CAN17_POLYNOMIAL_0001685B,
+                                               .init   = 0x00000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00000000L,
+                                               .result = 0 };
+
+static PyObject * _canx_can17( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_canx canx_param_can17 = { .is_initial=FALSE,
-                                                   .width  = 17,
-                                                   .poly   = CAN17_POLYNOMIAL_0001685B,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can17 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &canx_param_can17, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", (canx_param_can17.result & 0x1FFFF) );
+    return PyLong_FromUnsignedLong( result & 0x0001FFFF );
 }
 
-static PyObject * _canx_can21( PyObject *self, PyObject *args )
+static struct _hexin_canx canx_param_can21 = { .is_initial=FALSE,
+                                               .width  = 21,
+                                               .poly   = CAN21_POLYNOMIAL_00102899,
+                                               .init   = 0x00000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00000000L,
+                                               .result = 0 };
+
+static PyObject * _canx_can21( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_canx canx_param_can21= { .is_initial=FALSE,
-                                                   .width  = 21,
-                                                   .poly   = CAN21_POLYNOMIAL_00102899,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can21 ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &canx_param_can21, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", (canx_param_can21.result & 0x001FFFFF) );
+    return PyLong_FromUnsignedLong( result & 0x001FFFFF );
+}
+
+static PyObject * _canx_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
+        return NULL;
+    }
+
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_canx_catalogue {
+    const char          *name;
+    struct _hexin_canx  *param;
+} hexin_canx_params[] = {
+    { "can15", &canx_param_can15 },
+    { "can17", &canx_param_can17 },
+    { "can21", &canx_param_can21 },
+    { NULL, NULL }
+};
+
+static void hexin_canx_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_canx_params[i].name != NULL; i++ ) {
+        hexin_canx_compute_init( hexin_canx_params[i].param );
+    }
+}
+
+static PyObject * _canx_catalogue( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_canx *param = NULL;
+
+    if ( pdict == NULL ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_canx_params[i].name != NULL; i++ ) {
+        param = hexin_canx_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_canx_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
 }
 
 /* method table */
 static PyMethodDef _canxMethods[] = {
-    { "can15",      (PyCFunction)_canx_can15, METH_VARARGS, "Calculate CAN15 [Poly=0x4599, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "can17",      (PyCFunction)_canx_can17, METH_VARARGS, "Calculate CAN17 [Poly=0x1685B, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "can21",      (PyCFunction)_canx_can21, METH_VARARGS, "Calculate CAN21 [Poly=0x102899, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "can15",      (PyCFunction)_canx_can15, HEXIN_METH_FASTCALL, "Calculate CAN15 [Poly=0x4599, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "can17",      (PyCFunction)_canx_can17, HEXIN_METH_FASTCALL, "Calculate CAN17 [Poly=0x1685B, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "can21",      (PyCFunction)_canx_can21, HEXIN_METH_FASTCALL, "Calculate CAN21 [Poly=0x102899, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "_gil_threshold", (PyCFunction)_canx_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_canx_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -134,6 +238,8 @@ PyInit__canx( void )
 {
     PyObject *m = NULL;
 
+    hexin_canx_params_init();
+
     m = PyModule_Create( &_canxmodule );
     if ( m == NULL ) {
         return NULL;
@@ -151,6 +257,7 @@ PyInit__canx( void )
 PyMODINIT_FUNC
 init_canx( void )
 {
+    hexin_canx_params_init();
     (void) Py_InitModule3( "_canx", _canxMethods, _canx_doc );
 }
 
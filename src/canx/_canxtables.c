@@ -10,12 +10,32 @@
 * ---------------
 *		New Create at 	2020-04-21 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized Code.
+*                       2026-10-17 [Heyn] Split out hexin_canx_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] hexin_canx_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
 *
 *********************************************************************************************************
 */
 
 #include "_canxtables.h"
 
+#if defined( HEXIN_CONST_TABLES )
+#include "_canxconst.h"
+
+static const struct _hexin_canx_const *hexin_canx_const_lookup( const struct _hexin_canx *param )
+{
+    const struct _hexin_canx_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_canx_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
+
 static unsigned int hexin_canx_reverse32( unsigned int data )
 {
     unsigned int i = 0;
@@ -26,7 +46,7 @@ static unsigned int hexin_canx_reverse32( unsigned int data )
     return t;
 }
 
-static unsigned int hexin_canx_compute_init_table( struct _hexin_canx *param )
+static unsigned int hexin_canx_compute_init_table( struct _hexin_canx *param, unsigned int polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned int crc = 0x00000000L;
@@ -36,27 +56,28 @@ static unsigned int hexin_canx_compute_init_table( struct _hexin_canx *param )
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = i;
             for ( j=0; j<8; j++ ) {
-                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ param->poly;
+                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ polynomial;
                 else                     crc = ( crc >> 1 );
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c	= ( ( unsigned int )i ) << 24;
             for ( j=0; j<8; j++ ) {
-                if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ param->poly;
+                if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ polynomial;
                 else                              crc = ( crc << 1 );
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     }
+    param->table = param->table_buffer;
     return TRUE;
 }
 
-static unsigned int hexin_canx_compute_char( unsigned int crcx, unsigned char c, struct _hexin_canx *param )
+static unsigned int hexin_canx_compute_char( unsigned int crcx, unsigned char c, const struct _hexin_canx *param )
 {
     unsigned int crc = crcx;
 
@@ -69,20 +90,42 @@ static unsigned int hexin_canx_compute_char( unsigned int crcx, unsigned char c,
     return crc;
 }
 
-unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_canx *param )
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_canx_compute_init( struct _hexin_canx *param )
 {
-    unsigned int i = 0, result = 0;
-    unsigned int crc  = ( param->init << ( HEXIN_CANX_WIDTH - param->width ) );
+    unsigned int poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_canx_const *entry = NULL;
+#endif
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = ( hexin_canx_reverse32( param->poly ) >> ( HEXIN_CANX_WIDTH - param->width ) );
-        } else {
-            param->poly = ( param->poly << ( HEXIN_CANX_WIDTH - param->width ) );
-        }
-        param->is_initial = hexin_canx_compute_init_table( param );
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
     }
 
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_canx_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->is_initial = TRUE;
+        return TRUE;
+    }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        poly = ( hexin_canx_reverse32( param->poly ) >> ( HEXIN_CANX_WIDTH - param->width ) );
+    } else {
+        poly = ( param->poly << ( HEXIN_CANX_WIDTH - param->width ) );
+    }
+    param->is_initial = hexin_canx_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_canx *param )
+{
+    unsigned long long i = 0;
+    unsigned int result = 0;
+    unsigned int crc  = ( param->init << ( HEXIN_CANX_WIDTH - param->width ) );
+
 	for ( i=0; i<len; i++ ) {
 		crc = hexin_canx_compute_char( crc, pSrc[i], param );
 	}
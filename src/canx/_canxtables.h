@@ -10,6 +10,8 @@
 * ---------------
 *		New Create at 	2020-04-21 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized Code.
+*                       2026-10-17 [Heyn] New add hexin_canx_compute_init().
+*                       2026-10-17 [Heyn] Catalogue tables come from the generated _canxconst.h.
 *
 *********************************************************************************************************
 */
@@ -45,9 +47,19 @@ struct _hexin_canx {
     unsigned int  refout;
     unsigned int  xorout;
     unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
+    const unsigned int  *table;
+    unsigned int  table_buffer[MAX_TABLE_ARRAY];
 };
 
-unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_canx *param );
+/* One entry of the generated _canxconst.h ( see src/gentables.py ). */
+struct _hexin_canx_const {
+    unsigned int  width;
+    unsigned int  poly;
+    unsigned int  reflected;
+    const unsigned int  *table;
+};
+
+unsigned int hexin_canx_compute_init( struct _hexin_canx *param );
+unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_canx *param );
 
 #endif //__CANX_TABLES_H__
@@ -26,39 +26,64 @@
 *                       2020-04-08 [Heyn] New add libscrc.epc16() for RFID tag EPC
 *                       2020-04-17 [Heyn] Issues #1
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+*                       2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+*                       2026-10-17 [Heyn] hacker16 tables come from an LRU cache, New add _cache_info() / _cache_clear().
+*                       2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+*                       2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+*                       2026-10-17 [Heyn] New add t10_dif_blocks(), one T10-DIF guard per sector.
+*                       2026-10-17 [Heyn] New add modbus_many(), one CRC per buffer of a list.
+*                       2026-10-17 [Heyn] New add _records(), one CRC per fixed-size record behind libscrc.records().
+*                       2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+*                       2026-10-17 [Heyn] New add fletcher16_combine().
+*                       2026-10-17 [Heyn] New add network_sum() / network_combine() / network_update().
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+*                       2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
+*                       2026-10-17 [Heyn] Fix t10_dif_blocks() over 4 GB of data, the block count is 64-bit.
+*                       2026-10-17 [Heyn] Fix fletcher16_combine(), negative or 2**64 and larger arguments raise rather than wrap.
+*                       2026-10-17 [Heyn] Fix sick / fletcher16 over 4 GB, the helper passes the whole 64-bit length.
+*                       2026-10-17 [Heyn] Fix network_sum() / tcp / udp over 4 GB and network_combine(), negative or 2**64 and larger arguments raise.
 *
 *********************************************************************************************************
 */
 
 #include <Python.h>
 #include "_crc16tables.h"
+#include "_crc16simd.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
 
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+static unsigned char hexin_PyArg_ParseTuple( HEXIN_FASTCALL_PARAMS,
                                              unsigned short init,
                                              unsigned short (*function)( const unsigned char *,
-                                                                         unsigned int,
+                                                                         unsigned long long,
                                                                          unsigned short ),
                                              unsigned short *result )
 {
     Py_buffer data = { NULL, NULL };
+    PyObject *slots[2];
+    unsigned long long value = init;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "", "", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 2, slots ) || !hexin_PyArg_Mask( slots[1], &value )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned short )value;
 
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (unsigned long long)data.len, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = (* function)( (const unsigned char *)data.buf, (unsigned long long)data.len, init );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -66,27 +91,43 @@ static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
     return TRUE;
 }
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc16 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_crc16 *param, unsigned short *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned short )value;
+        } else {
+            *result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -94,251 +135,363 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc16_modbus( PyObject *self, PyObject *args )
+struct _hexin_crc16_many {
+    const struct _hexin_crc16  *param;
+    const Py_buffer            *buffers;
+    unsigned short             *values;
+};
+
+static void hexin_crc16_many_run( void *arg, Py_ssize_t begin, Py_ssize_t end )
 {
-    static struct _hexin_crc16 crc16_param_modbus = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_8005,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    struct _hexin_crc16_many *many = ( struct _hexin_crc16_many * )arg;
+    const unsigned char *pSrc[HEXIN_CRC16_MULTI_CHUNK];
+    unsigned int len[HEXIN_CRC16_MULTI_CHUNK];
+    Py_ssize_t i = 0, n = 0;
+
+    for ( ; begin<end; begin+=n ) {
+        n = ( end - begin < HEXIN_CRC16_MULTI_CHUNK ) ? ( end - begin ) : HEXIN_CRC16_MULTI_CHUNK;
+        for ( i=0; i<n; i++ ) {
+            pSrc[i] = ( const unsigned char * )many->buffers[begin + i].buf;
+            len[i]  = ( unsigned int )many->buffers[begin + i].len;
+        }
+        hexin_crc16_compute_many( pSrc, len, ( unsigned int )n, many->param, many->values + begin );
+    }
+}
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_modbus ) ) {
+/* One CRC per item of an iterable of buffers as array('H'), the list is split over threads when large. */
+static PyObject * hexin_PyArg_ParseMany_Paramete( PyObject *self, PyObject *args, PyObject *kws,
+                                                  const struct _hexin_crc16 *param )
+{
+    PyObject *seq = NULL, *pthreads = NULL, *values = NULL, *array = NULL, *result = NULL;
+    Py_buffer *buffers = NULL;
+    Py_ssize_t count = 0;
+    unsigned long long total = 0;
+    unsigned int threads = 0;
+    struct _hexin_crc16_many many;
+    const struct _hexin_model_capi *capi = hexin_model_capi_import();
+
+    static char* kwlist[]={ "buffers", "threads", NULL };
+
+    if ( !hexin_PyArg_Positional( args, 1 ) || !PyArg_ParseTupleAndKeywords( args, kws, "O|O", kwlist, &seq, &pthreads )
+      || !hexin_PyArg_Threads( pthreads, &threads ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_modbus.result );
-}
+    if ( capi == NULL ) {
+        PyErr_SetString( PyExc_ImportError, "libscrc._model is needed for the *_many() functions" );
+        return NULL;
+    }
 
-static PyObject * _crc16_usb( PyObject *self, PyObject *args )
-{
-    static struct _hexin_crc16 crc16_param_usb = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_8005,
-                                                   .init   = 0xFFFF,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    buffers = capi->buffers_acquire( seq, &count, &total );
+    if ( buffers == NULL ) {
+        return NULL;
+    }
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_usb ) ) {
+    values = PyBytes_FromStringAndSize( NULL, count * sizeof( unsigned short ) );
+    if ( values == NULL ) {
+        capi->buffers_release( buffers, count );
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_usb.result );
-}
+    many.param   = param;
+    many.buffers = buffers;
+    many.values  = ( unsigned short * )PyBytes_AS_STRING( values );
 
-static PyObject * _crc16_ibm( PyObject *self, PyObject *args )
-{
-    static struct _hexin_crc16 crc16_param_ibm = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_8005,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x0000,
-                                                   .result = 0 };
+    if ( total >= ( unsigned long long )hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        capi->parallel_for( hexin_crc16_many_run, &many, count, capi->threads( total, threads ) );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_crc16_many_run( &many, 0, count );
+    }
+    capi->buffers_release( buffers, count );
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ibm ) ) {
-        return NULL;
+    array = PyImport_ImportModule( "array" );
+    if ( array != NULL ) {
+        result = PyObject_CallMethod( array, "array", "sO", "H", values );
+        Py_DECREF( array );
     }
+    Py_DECREF( values );
 
-    return Py_BuildValue( "H", crc16_param_ibm.result );
+    return result;
 }
 
-static PyObject * _crc16_xmodem( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_modbus = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_8005,
+                                                  .init   = 0xFFFF,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_modbus( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_xmodem = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_xmodem ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_modbus, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_xmodem.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
+static PyObject * _crc16_modbus_many( PyObject *self, PyObject *args, PyObject *kws )
+{
+    return hexin_PyArg_ParseMany_Paramete( self, args, kws, &crc16_param_modbus );
+}
+
+static struct _hexin_crc16 crc16_param_usb = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_8005,
+                                               .init   = 0xFFFF,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFF,
+                                               .result = 0 };
 
-static PyObject * _crc16_ccitt( PyObject *self, PyObject *args )
+static PyObject * _crc16_usb( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_ccitt_false = { .is_initial=FALSE,
-                                                           .width  = HEXIN_CRC16_WIDTH,
-                                                           .poly   = CRC16_POLYNOMIAL_1021,
-                                                           .init   = 0xFFFF,
-                                                           .refin  = FALSE,
-                                                           .refout = FALSE,
-                                                           .xorout = 0x0000,
-                                                           .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ccitt_false ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_usb, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ccitt_false.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_ccitt_aug( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_ibm = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_8005,
+                                               .init   = 0x0000,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x0000,
+                                               .result = 0 };
+
+static PyObject * _crc16_ibm( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_ccitt_aug = { .is_initial=FALSE,
-                                                         .width  = HEXIN_CRC16_WIDTH,
-                                                         .poly   = CRC16_POLYNOMIAL_1021,
-                                                         .init   = 0x1D0F,
-                                                         .refin  = FALSE,
-                                                         .refout = FALSE,
-                                                         .xorout = 0x0000,
-                                                         .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ccitt_aug ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_ibm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ccitt_aug.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_kermit( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_xmodem = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0x0000,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_xmodem( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_kermit = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x0000,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_kermit ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_xmodem, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_kermit.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_mcrf4xx( PyObject *self, PyObject *args )
-{
-    static struct _hexin_crc16 crc16_param_mcrf4xx = { .is_initial=FALSE,
+
+static struct _hexin_crc16 crc16_param_ccitt_false = { .is_initial=FALSE,
                                                        .width  = HEXIN_CRC16_WIDTH,
                                                        .poly   = CRC16_POLYNOMIAL_1021,
                                                        .init   = 0xFFFF,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
+                                                       .refin  = FALSE,
+                                                       .refout = FALSE,
                                                        .xorout = 0x0000,
                                                        .result = 0 };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_mcrf4xx ) ) {
+static PyObject * _crc16_ccitt( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_ccitt_false, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc16 crc16_param_ccitt_aug = { .is_initial=FALSE,
+                                                     .width  = HEXIN_CRC16_WIDTH,
+                                                     .poly   = CRC16_POLYNOMIAL_1021,
+                                                     .init   = 0x1D0F,
+                                                     .refin  = FALSE,
+                                                     .refout = FALSE,
+                                                     .xorout = 0x0000,
+                                                     .result = 0 };
+
+static PyObject * _crc16_ccitt_aug( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_ccitt_aug, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_mcrf4xx.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_x25( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_kermit = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0x0000,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_kermit( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_x25 = { .is_initial=FALSE,
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_kermit, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc16 crc16_param_mcrf4xx = { .is_initial=FALSE,
                                                    .width  = HEXIN_CRC16_WIDTH,
                                                    .poly   = CRC16_POLYNOMIAL_1021,
                                                    .init   = 0xFFFF,
                                                    .refin  = TRUE,
                                                    .refout = TRUE,
-                                                   .xorout = 0xFFFF,
+                                                   .xorout = 0x0000,
                                                    .result = 0 };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_x25 ) ) {
+static PyObject * _crc16_mcrf4xx( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_mcrf4xx, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc16 crc16_param_x25 = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_1021,
+                                               .init   = 0xFFFF,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFF,
+                                               .result = 0 };
+
+static PyObject * _crc16_x25( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_x25, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_x25.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_sick( PyObject *self, PyObject *args )
+static PyObject * _crc16_sick( HEXIN_FASTCALL_PARAMS )
 {
     unsigned short result = 0x0000;
     unsigned short init   = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc16_sick, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, init, hexin_calc_crc16_sick, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dnp( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_dnp = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_3D65,
+                                               .init   = 0x0000,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFF,
+                                               .result = 0 };
+
+static PyObject * _crc16_dnp( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dnp = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_3D65,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dnp ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_dnp, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dnp.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_maxim( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_maxim = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_8005,
+                                                 .init   = 0x0000,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0xFFFF,
+                                                 .result = 0 };
+
+static PyObject * _crc16_maxim( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_maxim = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_8005,
-                                                     .init   = 0x0000,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_maxim ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_maxim, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_maxim.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dect_r( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_dectr = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_0589,
+                                                 .init   = 0x0000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x0001,
+                                                 .result = 0 };
+
+static PyObject * _crc16_dect_r( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dectr = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_0589,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0001,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dectr ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_dectr, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dectr.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dect_x( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_dectx = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_0589,
+                                                 .init   = 0x0000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x0000,
+                                                 .result = 0 };
+
+static PyObject * _crc16_dect_x( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dectx = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_0589,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dectx ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_dectx, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dectx.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc16_table( PyObject *self, PyObject *args )
@@ -364,15 +517,16 @@ static PyObject * _crc16_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "H", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc16_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc16_hacker( HEXIN_FASTCALL_PARAMS )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int cache = 0;
     struct _hexin_crc16 crc16_param_hacker = { .is_initial=FALSE,
                                                .width  = HEXIN_CRC16_WIDTH,
                                                .poly   = CRC16_POLYNOMIAL_8005,
@@ -381,439 +535,987 @@ static PyObject * _crc16_hacker( PyObject *self, PyObject *args, PyObject* kws )
                                                .refout = TRUE,
                                                .xorout = 0x0000,
                                                .result = 0 };
+    unsigned long long poly   = crc16_param_hacker.poly;
+    unsigned long long init   = crc16_param_hacker.init;
+    unsigned long long xorout = crc16_param_hacker.xorout;
+    PyObject *slots[6];
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    static const char *const kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|HHHpp", kwlist, &data,
-                                                                      &crc16_param_hacker.poly,
-                                                                      &crc16_param_hacker.init,
-                                                                      &crc16_param_hacker.xorout,
-                                                                      &crc16_param_hacker.refin,
-                                                                      &crc16_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 6, slots )
+      || !hexin_PyArg_Mask( slots[1], &poly ) || !hexin_PyArg_Mask( slots[2], &init ) || !hexin_PyArg_Mask( slots[3], &xorout )
+      || !hexin_PyArg_Bool( slots[4], &crc16_param_hacker.refin ) || !hexin_PyArg_Bool( slots[5], &crc16_param_hacker.refout )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|HHHpp", kwlist, &data,
-                                                                      &crc16_param_hacker.poly,
-                                                                      &crc16_param_hacker.init,
-                                                                      &crc16_param_hacker.xorout,
-                                                                      &crc16_param_hacker.refin,
-                                                                      &crc16_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;
+    crc16_param_hacker.poly   = ( unsigned short )poly;
+    crc16_param_hacker.init   = ( unsigned short )init;
+    crc16_param_hacker.xorout = ( unsigned short )xorout;
+
+    cache = hexin_crc16_cache_acquire( &crc16_param_hacker );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        crc16_param_hacker.result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc16_param_hacker );
+        Py_END_ALLOW_THREADS
+    } else {
+        crc16_param_hacker.result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc16_param_hacker );
     }
-#endif /* PY_MAJOR_VERSION */
 
-    crc16_param_hacker.result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc16_param_hacker );
+    hexin_crc16_cache_release( cache );
 
     if ( data.obj )
        PyBuffer_Release( &data );
 
-    return Py_BuildValue( "H", crc16_param_hacker.result );
+    return PyLong_FromUnsignedLong( crc16_param_hacker.result );
 }
 
-static PyObject * _crc16_network( PyObject *self, PyObject *args )
+static PyObject * _crc16_network( HEXIN_FASTCALL_PARAMS )
 {
     unsigned short result   = 0x0000;
     unsigned short reserved = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc16_network, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc16_network, ( unsigned short * )&result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+/* network_sum( data, previous=0 ), the folded ones' complement sum before inversion, tcp( data ) == ~network_sum( data ) & 0xFFFF. */
+static PyObject * _crc16_network_sum( HEXIN_FASTCALL_PARAMS )
+{
+    Py_buffer data = { NULL, NULL };
+    PyObject *slots[2];
+    unsigned long long sum = 0;
+
+    static const char *const kwlist[]={ "", "", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 2, slots ) || !hexin_PyArg_Mask( slots[1], &sum )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
+        return NULL;
+    }
+    sum &= 0xFFFF;
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        sum = hexin_crc16_network_sum( sum, (const unsigned char *)data.buf, (unsigned long long)data.len );
+        Py_END_ALLOW_THREADS
+    } else {
+        sum = hexin_crc16_network_sum( sum, (const unsigned char *)data.buf, (unsigned long long)data.len );
+    }
+
+    if ( data.obj )
+       PyBuffer_Release( &data );
+
+    return PyLong_FromUnsignedLong( hexin_crc16_network_fold( sum ) );
+}
+
+static PyObject * _crc16_network_combine( PyObject *self, PyObject *args )
+{
+    PyObject *psum1 = NULL, *psum2 = NULL, *plen1 = NULL;
+    unsigned long long sum1 = 0, sum2 = 0, len1 = 0;
+
+    if ( !PyArg_ParseTuple( args, "OOO:network_combine", &psum1, &psum2, &plen1 )
+      || !hexin_PyArg_Unsigned( psum1, &sum1 ) || !hexin_PyArg_Unsigned( psum2, &sum2 ) || !hexin_PyArg_Unsigned( plen1, &len1 ) ) {
+        return NULL;
+    }
+
+    if ( ( sum1 | sum2 ) > 0xFFFFULL ) {
+        PyErr_SetString( PyExc_ValueError, "sum must fit in 16 bits" );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( hexin_crc16_network_combine( ( unsigned short )sum1, ( unsigned short )sum2, len1 ) );
+}
+
+static PyObject * _crc16_network_update( PyObject *self, PyObject *args )
+{
+    unsigned long long check = 0, old_sum = 0, new_sum = 0;
+
+    if ( !PyArg_ParseTuple( args, "KKK:network_update", &check, &old_sum, &new_sum ) ) {
+        return NULL;
+    }
+
+    if ( ( check | old_sum | new_sum ) > 0xFFFFULL ) {
+        PyErr_SetString( PyExc_ValueError, "checksum and sums must fit in 16 bits" );
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return PyLong_FromUnsignedLong( hexin_crc16_network_update( ( unsigned short )check, ( unsigned short )old_sum, ( unsigned short )new_sum ) );
 }
 
-static PyObject * _crc16_fletcher( PyObject *self, PyObject *args )
+static PyObject * _crc16_fletcher( HEXIN_FASTCALL_PARAMS )
 {
     unsigned short result   = 0x0000;
     unsigned short reserved = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc16_fletcher, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc16_fletcher, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_rfid_epc( PyObject *self, PyObject *args )
+static PyObject * _crc16_fletcher16_combine( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc16 crc16_param_epc16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_1021,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    PyObject *pfletcher1 = NULL, *pfletcher2 = NULL, *plen2 = NULL;
+    unsigned long long fletcher1 = 0, fletcher2 = 0, len2 = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_epc16 ) ) {
+    if ( !PyArg_ParseTuple( args, "OOO:fletcher16_combine", &pfletcher1, &pfletcher2, &plen2 )
+      || !hexin_PyArg_Unsigned( pfletcher1, &fletcher1 ) || !hexin_PyArg_Unsigned( pfletcher2, &fletcher2 ) || !hexin_PyArg_Unsigned( plen2, &len2 ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_epc16.result );
+    if ( ( fletcher1 | fletcher2 ) > 0xFFFFULL ) {
+        PyErr_SetString( PyExc_ValueError, "fletcher must fit in 16 bits" );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( hexin_crc16_fletcher_combine( ( unsigned short )fletcher1, ( unsigned short )fletcher2, len2 ) );
 }
 
-static PyObject * _crc16_profibus( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_epc16 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_1021,
+                                                 .init   = 0xFFFF,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFF,
+                                                 .result = 0 };
+
+static PyObject * _crc16_rfid_epc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_profibus = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC16_WIDTH,
-                                                        .poly   = CRC16_POLYNOMIAL_1DCF,
-                                                        .init   = 0xFFFF,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0xFFFF,
-                                                        .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_profibus ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_epc16, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_profibus.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_buypass( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_profibus = { .is_initial=FALSE,
+                                                    .width  = HEXIN_CRC16_WIDTH,
+                                                    .poly   = CRC16_POLYNOMIAL_1DCF,
+                                                    .init   = 0xFFFF,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0xFFFF,
+                                                    .result = 0 };
+
+static PyObject * _crc16_profibus( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_buypass = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_8005,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_buypass ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_profibus, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_buypass.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_gsm16( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_buypass = { .is_initial=FALSE,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_8005,
+                                                   .init   = 0x0000,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x0000,
+                                                   .result = 0 };
+
+static PyObject * _crc16_buypass( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_gsm16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_1021,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_gsm16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_buypass, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_gsm16.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_riello( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_gsm16 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_1021,
+                                                 .init   = 0x0000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFF,
+                                                 .result = 0 };
+
+static PyObject * _crc16_gsm16( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_riello = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0xB2AA,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_riello ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_gsm16, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_riello.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_crc16_a( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_riello = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0xB2AA,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_riello( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_crc16a = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0xC6C6,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_crc16a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_riello, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_crc16a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_cdma2000( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_crc16a = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0xC6C6,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_crc16_a( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_cdma2000 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_C867,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_crc16a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_cdma2000.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_teledisk( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_cdma2000 = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_C867,
+                                                  .init   = 0xFFFF,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_cdma2000( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_teledisk = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = 0xA097,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_teledisk ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_cdma2000, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_teledisk.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_tms37157( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_teledisk = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = 0xA097,
+                                                  .init   = 0x0000,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_teledisk( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_tms37157 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x89EC,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_tms37157 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_teledisk, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_tms37157.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_en13757( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_tms37157 = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0x89EC,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_tms37157( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_en13757 = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_3D65,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0xFFFF,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_en13757 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_tms37157, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_en13757.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_t10_dif( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_en13757 = { .is_initial=FALSE,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_3D65,
+                                                   .init   = 0x0000,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0xFFFF,
+                                                   .result = 0 };
+
+static PyObject * _crc16_en13757( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_t10_dif = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = 0x8BB7,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_t10_dif ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_en13757, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_t10_dif.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dds_110( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_t10_dif = { .is_initial=FALSE,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = 0x8BB7,
+                                                   .init   = 0x0000,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x0000,
+                                                   .result = 0 };
+
+static PyObject * _crc16_t10_dif( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dds_110 = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_8005,
-                                                       .init   = 0x800D,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dds_110 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_t10_dif, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dds_110.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_cms( PyObject *self, PyObject *args )
+/*
+ * The guard of every block_size bytes as array('H'). With out, a writable buffer, the
+ * guards go into it big-endian ( as in the protection information ) and their count is returned.
+ */
+static PyObject * _crc16_t10_dif_blocks( PyObject *self, PyObject *args, PyObject *kws )
 {
-    static struct _hexin_crc16 crc16_param_cms16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_8005,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    Py_buffer data = { NULL, NULL };
+    Py_buffer out  = { NULL, NULL };
+    Py_ssize_t block_size = 512, count = 0, i = 0;
+    PyObject *pout = Py_None, *guards = NULL, *array = NULL, *result = NULL;
+    unsigned short *values = NULL;
+    unsigned char *pDst = NULL;
+
+    static char* kwlist[]={ "data", "block_size", "out", NULL };
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|nO", kwlist, &data, &block_size, &pout ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#else
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|nO", kwlist, &data, &block_size, &pout ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#endif /* PY_MAJOR_VERSION */
+
+    if ( ( block_size <= 0 ) || ( ( unsigned long long )block_size > 0xFFFFFFFFULL ) ) {
+        PyErr_SetString( PyExc_ValueError, "block_size must be 1 to 0xFFFFFFFF bytes" );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( data.len % block_size != 0 ) {
+        PyErr_SetString( PyExc_ValueError, "data must be a whole number of block_size bytes" );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+    count = data.len / block_size;
+
+    if ( pout != Py_None ) {
+        if ( PyObject_GetBuffer( pout, &out, PyBUF_WRITABLE ) < 0 ) {
+            PyBuffer_Release( &data );
+            return NULL;
+        }
+        if ( out.len < count * 2 ) {
+            PyErr_Format( PyExc_ValueError, "out needs %zd bytes for %zd guards", count * 2, count );
+            PyBuffer_Release( &out );
+            PyBuffer_Release( &data );
+            return NULL;
+        }
+        values = ( unsigned short * )PyMem_Malloc( count * sizeof( unsigned short ) + 1 );
+        if ( values == NULL ) {
+            PyBuffer_Release( &out );
+            PyBuffer_Release( &data );
+            return PyErr_NoMemory();
+        }
+    } else {
+        guards = PyBytes_FromStringAndSize( NULL, count * sizeof( unsigned short ) );
+        if ( guards == NULL ) {
+            PyBuffer_Release( &data );
+            return NULL;
+        }
+        values = ( unsigned short * )PyBytes_AS_STRING( guards );
+    }
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        hexin_crc16_compute_blocks( (const unsigned char *)data.buf, (unsigned long long)data.len, (unsigned int)block_size,
+                                    &crc16_param_t10_dif, values );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_crc16_compute_blocks( (const unsigned char *)data.buf, (unsigned long long)data.len, (unsigned int)block_size,
+                                    &crc16_param_t10_dif, values );
+    }
+    PyBuffer_Release( &data );
+
+    if ( pout != Py_None ) {
+        pDst = ( unsigned char * )out.buf;
+        for ( i=0; i<count; i++ ) {
+            pDst[2*i+0] = ( unsigned char )( values[i] >> 8 );
+            pDst[2*i+1] = ( unsigned char )( values[i] & 0xFF );
+        }
+        PyMem_Free( values );
+        PyBuffer_Release( &out );
+        return PyLong_FromSsize_t( count );
+    }
+
+    array = PyImport_ImportModule( "array" );
+    if ( array != NULL ) {
+        result = PyObject_CallMethod( array, "array", "sO", "H", guards );
+        Py_DECREF( array );
+    }
+    Py_DECREF( guards );
+
+    return result;
+}
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_cms16 ) ) {
+static struct _hexin_crc16 crc16_param_dds_110 = { .is_initial=FALSE,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_8005,
+                                                   .init   = 0x800D,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x0000,
+                                                   .result = 0 };
+
+static PyObject * _crc16_dds_110( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_dds_110, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_cms16.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_lj1200( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_cms16 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_8005,
+                                                 .init   = 0xFFFF,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x0000,
+                                                 .result = 0 };
+
+static PyObject * _crc16_cms( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_lj1200 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = 0x6F63,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_lj1200 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_cms16, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_lj1200.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_nrsc5( PyObject *self, PyObject *args )
+static struct _hexin_crc16 crc16_param_lj1200 = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = 0x6F63,
+                                                  .init   = 0x0000,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .result = 0 };
+
+static PyObject * _crc16_lj1200( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_nrsc5 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = 0x080B,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_lj1200, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc16 crc16_param_nrsc5 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = 0x080B,
+                                                 .init   = 0xFFFF,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0x0000,
+                                                 .result = 0 };
+
+static PyObject * _crc16_nrsc5( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_nrsc5, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc16 crc16_param_opensafety_a = { .is_initial=FALSE,
+                                                        .width  = HEXIN_CRC16_WIDTH,
+                                                        .poly   = 0x5935,
+                                                        .init   = 0x0000,
+                                                        .refin  = FALSE,
+                                                        .refout = FALSE,
+                                                        .xorout = 0x0000,
+                                                        .result = 0 };
+
+static PyObject * _crc16_opensafety_a( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_opensafety_a, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc16 crc16_param_opensafety_b = { .is_initial=FALSE,
+                                                        .width  = HEXIN_CRC16_WIDTH,
+                                                        .poly   = 0x755B,
+                                                        .init   = 0x0000,
+                                                        .refin  = FALSE,
+                                                        .refout = FALSE,
+                                                        .xorout = 0x0000,
+                                                        .result = 0 };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_nrsc5 ) ) {
+static PyObject * _crc16_opensafety_b( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc16_param_opensafety_b, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static PyObject * _crc16_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_nrsc5.result );
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+static PyObject * _crc16_cache_info( PyObject *self, PyObject *args )
+{
+    unsigned long long hits = 0, misses = 0;
+    unsigned int count = 0;
+
+    hexin_crc16_cache_info( &hits, &misses, &count );
+    return Py_BuildValue( "KKII", hits, misses, ( unsigned int )HEXIN_CRC16_CACHE_SIZE, count );
+}
+
+static PyObject * _crc16_cache_clear( PyObject *self, PyObject *args )
+{
+    hexin_crc16_cache_clear();
+    Py_RETURN_NONE;
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_crc16_catalogue {
+    const char          *name;
+    struct _hexin_crc16  *param;
+} hexin_crc16_params[] = {
+    { "modbus",       &crc16_param_modbus },
+    { "usb16",        &crc16_param_usb },
+    { "ibm",          &crc16_param_ibm },
+    { "arc",          &crc16_param_ibm },
+    { "lha",          &crc16_param_ibm },
+    { "xmodem",       &crc16_param_xmodem },
+    { "zmodem",       &crc16_param_xmodem },
+    { "acorn",        &crc16_param_xmodem },
+    { "v41_msb",      &crc16_param_xmodem },
+    { "lte16",        &crc16_param_xmodem },
+    { "ccitt_aug",    &crc16_param_ccitt_aug },
+    { "spi_fujitsu",  &crc16_param_ccitt_aug },
+    { "ccitt_false",  &crc16_param_ccitt_false },
+    { "ibm_3740",     &crc16_param_ccitt_false },
+    { "autosar16",    &crc16_param_ccitt_false },
+    { "kermit",       &crc16_param_kermit },
+    { "ccitt_true",   &crc16_param_kermit },
+    { "ccitt",        &crc16_param_kermit },
+    { "v41_lsb",      &crc16_param_kermit },
+    { "mcrf4xx",      &crc16_param_mcrf4xx },
+    { "dnp",          &crc16_param_dnp },
+    { "x25",          &crc16_param_x25 },
+    { "ibm_sdlc",     &crc16_param_x25 },
+    { "iso_hdlc16",   &crc16_param_x25 },
+    { "iec14443_3_b", &crc16_param_x25 },
+    { "maxim16",      &crc16_param_maxim },
+    { "dect_r",       &crc16_param_dectr },
+    { "dect_x",       &crc16_param_dectx },
+    { "epc16",        &crc16_param_epc16 },
+    { "profibus",     &crc16_param_profibus },
+    { "buypass",      &crc16_param_buypass },
+    { "umts",         &crc16_param_buypass },
+    { "verifone",     &crc16_param_buypass },
+    { "genibus",      &crc16_param_epc16 },
+    { "darc",         &crc16_param_epc16 },
+    { "epc_c1g2",     &crc16_param_epc16 },
+    { "icode16",      &crc16_param_epc16 },
+    { "gsm16",        &crc16_param_gsm16 },
+    { "riello",       &crc16_param_riello },
+    { "crc16_a",      &crc16_param_crc16a },
+    { "iec14443_3_a", &crc16_param_crc16a },
+    { "cdma2000",     &crc16_param_cdma2000 },
+    { "teledisk",     &crc16_param_teledisk },
+    { "tms37157",     &crc16_param_tms37157 },
+    { "en13757",      &crc16_param_en13757 },
+    { "t10_dif",      &crc16_param_t10_dif },
+    { "dds_110",      &crc16_param_dds_110 },
+    { "cms",          &crc16_param_cms16 },
+    { "lj1200",       &crc16_param_lj1200 },
+    { "nrsc5",        &crc16_param_nrsc5 },
+    { "opensafety_a", &crc16_param_opensafety_a },
+    { "opensafety_b", &crc16_param_opensafety_b },
+    { NULL, NULL }
+};
+
+static void hexin_crc16_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_crc16_params[i].name != NULL; i++ ) {
+        hexin_crc16_compute_init( hexin_crc16_params[i].param );
+    }
 }
 
-static PyObject * _crc16_opensafety_a( PyObject *self, PyObject *args )
+static PyObject * _crc16_catalogue( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc16 crc16_param_opensafety_a = { .is_initial=FALSE,
-                                                            .width  = HEXIN_CRC16_WIDTH,
-                                                            .poly   = 0x5935,
-                                                            .init   = 0x0000,
-                                                            .refin  = FALSE,
-                                                            .refout = FALSE,
-                                                            .xorout = 0x0000,
-                                                            .result = 0 };
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_crc16 *param = NULL;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_opensafety_a ) ) {
+    if ( pdict == NULL ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_opensafety_a.result );
+    for ( i=0; hexin_crc16_params[i].name != NULL; i++ ) {
+        param = hexin_crc16_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_crc16_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
+}
+
+struct _hexin_crc16_records {
+    const struct _hexin_crc16  *param;
+    const unsigned char        *pSrc;
+    Py_ssize_t                  record_size;
+    Py_ssize_t                  offset;
+    Py_ssize_t                  length;
+    unsigned short             *values;
+};
+
+static void hexin_crc16_records_run( void *arg, Py_ssize_t begin, Py_ssize_t end )
+{
+    struct _hexin_crc16_records *records = ( struct _hexin_crc16_records * )arg;
+    const unsigned char *pSrc[HEXIN_CRC16_MULTI_CHUNK];
+    unsigned int len[HEXIN_CRC16_MULTI_CHUNK];
+    Py_ssize_t i = 0, n = 0;
+
+    for ( ; begin<end; begin+=n ) {
+        n = ( end - begin < HEXIN_CRC16_MULTI_CHUNK ) ? ( end - begin ) : HEXIN_CRC16_MULTI_CHUNK;
+        for ( i=0; i<n; i++ ) {
+            pSrc[i] = records->pSrc + ( begin + i ) * records->record_size + records->offset;
+            len[i]  = ( unsigned int )records->length;
+        }
+        hexin_crc16_compute_many( pSrc, len, ( unsigned int )n, records->param, records->values + begin );
+    }
+}
+
+/* Checks the records() layout against len bytes of data, FALSE with an exception set when it does not fit. */
+static unsigned int hexin_records_layout( Py_ssize_t len, Py_ssize_t record_size, Py_ssize_t offset, PyObject *plength,
+                                          PyObject *pcheck, Py_ssize_t field_size, const char *byteorder,
+                                          Py_ssize_t *length, Py_ssize_t *check, unsigned int *little )
+{
+    if ( ( record_size <= 0 ) || ( len % record_size != 0 ) ) {
+        PyErr_SetString( PyExc_ValueError, "data must be a whole number of record_size bytes" );
+        return FALSE;
+    }
+
+    *length = record_size - offset;
+    if ( plength != Py_None ) {
+        *length = PyNumber_AsSsize_t( plength, PyExc_OverflowError );
+        if ( ( *length == -1 ) && PyErr_Occurred() ) {
+            return FALSE;
+        }
+    }
+    if ( ( offset < 0 ) || ( *length < 0 ) || ( offset + *length > record_size ) || ( *length > 0xFFFFFFFFL ) ) {
+        PyErr_SetString( PyExc_ValueError, "offset and length must lie within the record" );
+        return FALSE;
+    }
+
+    *check = -1;
+    if ( pcheck != Py_None ) {
+        *check = PyNumber_AsSsize_t( pcheck, PyExc_OverflowError );
+        if ( ( *check == -1 ) && PyErr_Occurred() ) {
+            return FALSE;
+        }
+        if ( ( *check < 0 ) || ( *check + field_size > record_size ) ) {
+            PyErr_SetString( PyExc_ValueError, "the check field must lie within the record" );
+            return FALSE;
+        }
+    }
+
+    if ( ( strcmp( byteorder, "big" ) != 0 ) && ( strcmp( byteorder, "little" ) != 0 ) ) {
+        PyErr_SetString( PyExc_ValueError, "byteorder must be either 'little' or 'big'" );
+        return FALSE;
+    }
+    *little = ( strcmp( byteorder, "little" ) == 0 ) ? TRUE : FALSE;
+
+    return TRUE;
 }
 
-static PyObject * _crc16_opensafety_b( PyObject *self, PyObject *args )
+/*
+ * One CRC of record[offset:offset+length] per record_size bytes as array('H'). With check, the CRC
+ * stored at that offset of every record is compared instead and the indexes that differ come back.
+ */
+static PyObject * _crc16_records( PyObject *self, PyObject *args, PyObject *kws )
 {
-    static struct _hexin_crc16 crc16_param_opensafety_b = { .is_initial=FALSE,
-                                                            .width  = HEXIN_CRC16_WIDTH,
-                                                            .poly   = 0x755B,
-                                                            .init   = 0x0000,
-                                                            .refin  = FALSE,
-                                                            .refout = FALSE,
-                                                            .xorout = 0x0000,
-                                                            .result = 0 };
+    Py_buffer data = { NULL, NULL };
+    const char *name = NULL, *byteorder = "big";
+    Py_ssize_t record_size = 0, offset = 0, check = -1, count = 0, i = 0, bad = 0;
+    PyObject *plength = Py_None, *pcheck = Py_None, *pthreads = NULL, *values = NULL, *array = NULL, *result = NULL;
+    unsigned int threads = 0, little = FALSE;
+    unsigned short stored = 0;
+    unsigned long long *indexes = NULL;
+    const unsigned char *pField = NULL;
+    struct _hexin_crc16_records records = { NULL };
+    const struct _hexin_model_capi *capi = NULL;
+
+    static char* kwlist[]={ "name", "data", "record_size", "offset", "length", "check", "byteorder", "threads", NULL };
+
+    if ( !hexin_PyArg_Positional( args, 7 ) ) {
+        return NULL;
+    }
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "sy*n|nOOsO", kwlist, &name, &data, &record_size, &offset,
+                                       &plength, &pcheck, &byteorder, &pthreads ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#else
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "ss*n|nOOsO", kwlist, &name, &data, &record_size, &offset,
+                                       &plength, &pcheck, &byteorder, &pthreads ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#endif /* PY_MAJOR_VERSION */
+
+    if ( !hexin_PyArg_Threads( pthreads, &threads ) ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc16_params[i].name != NULL; i++ ) {
+        if ( strcmp( hexin_crc16_params[i].name, name ) == 0 ) {
+            records.param = hexin_crc16_params[i].param;
+            break;
+        }
+    }
+    if ( records.param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unsupported CRC16 model '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( !hexin_records_layout( data.len, record_size, offset, plength, pcheck, sizeof( unsigned short ), byteorder,
+                                &records.length, &check, &little ) ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    count  = data.len / record_size;
+    values = PyBytes_FromStringAndSize( NULL, count * sizeof( unsigned short ) );
+    if ( values == NULL ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    records.pSrc        = ( const unsigned char * )data.buf;
+    records.record_size = record_size;
+    records.offset      = offset;
+    records.values      = ( unsigned short * )PyBytes_AS_STRING( values );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        capi = hexin_model_capi_import();
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi != NULL ) {
+            capi->parallel_for( hexin_crc16_records_run, &records, count, capi->threads( ( unsigned long long )data.len, threads ) );
+        } else {
+            hexin_crc16_records_run( &records, 0, count );
+        }
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_crc16_records_run( &records, 0, count );
+    }
+
+    if ( check >= 0 ) {
+        indexes = ( unsigned long long * )PyMem_Malloc( count * sizeof( unsigned long long ) + 1 );
+        if ( indexes == NULL ) {
+            Py_DECREF( values );
+            PyBuffer_Release( &data );
+            return PyErr_NoMemory();
+        }
+        for ( i=0; i<count; i++ ) {
+            pField = records.pSrc + i * record_size + check;
+            stored = little ? ( unsigned short )( pField[0] | ( pField[1] << 8 ) ) : ( unsigned short )( ( pField[0] << 8 ) | pField[1] );
+            if ( stored != records.values[i] ) {
+                indexes[bad++] = ( unsigned long long )i;
+            }
+        }
+        Py_DECREF( values );
+        values = PyBytes_FromStringAndSize( ( const char * )indexes, bad * sizeof( unsigned long long ) );
+        PyMem_Free( indexes );
+    }
+    PyBuffer_Release( &data );
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_opensafety_b ) ) {
+    if ( values == NULL ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_opensafety_b.result );
+    array = PyImport_ImportModule( "array" );
+    if ( array != NULL ) {
+        result = PyObject_CallMethod( array, "array", "sO", ( check >= 0 ) ? "Q" : "H", values );
+        Py_DECREF( array );
+    }
+    Py_DECREF( values );
+
+    return result;
 }
 
 /* method table */
 static PyMethodDef _crc16Methods[] = {
-    { "modbus",      (PyCFunction)_crc16_modbus,    METH_VARARGS, "Calculate MODBUS of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
-    { "usb16",       (PyCFunction)_crc16_usb,       METH_VARARGS, "Calculate USB of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "ibm",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "arc",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate ARC (Alias:IBM/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "lha",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate LHA (Alias:ARC/IBM) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "xmodem",      (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate XMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "zmodem",      (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate ZMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "acorn",       (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate ACORN of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "v41_msb",     (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate V-41-MSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "lte16",       (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate LTE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "ccitt_aug",   (PyCFunction)_crc16_ccitt_aug, METH_VARARGS, "Calculate CCITT-AUG of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
-    { "spi_fujitsu", (PyCFunction)_crc16_ccitt_aug, METH_VARARGS, "Calculate SPI-FUJITSU of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
-    { "ccitt_false", (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate CCITT-FALSE of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "ibm_3740",    (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate IBM-3740 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "autosar16",   (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate AUTOSAR of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "kermit",      (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate KERMIT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "ccitt_true",  (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate CCITT-TRUE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "ccitt",       (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate CCITT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "v41_lsb",     (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate V-41-LSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "mcrf4xx",     (PyCFunction)_crc16_mcrf4xx,   METH_VARARGS, "Calculate MCRF4XX of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
-    { "sick",        (PyCFunction)_crc16_sick,      METH_VARARGS, "Calculate SICK of CRC16 [Poly=0x8005, Init=0x0000]" },
-    { "dnp",         (PyCFunction)_crc16_dnp,       METH_VARARGS, "Calculate DNP (Ues:M-Bus, ICE870) of CRC16 [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "x25",         (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate X25 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "ibm_sdlc",    (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate IBM-SDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "iso_hdlc16",  (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate ISO-HDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "iec14443_3_b",(PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate ISO-IEC-14443-3-B of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "maxim16",     (PyCFunction)_crc16_maxim,     METH_VARARGS, "Calculate MAXIM(MAXIM-DOW) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0xFFFF Refin=True Refout=True]" },
-    { "dect_r",      (PyCFunction)_crc16_dect_r,    METH_VARARGS, "Calculate DECT-R of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0001 Refin=False Refout=False]" },
-    { "dect_x",      (PyCFunction)_crc16_dect_x,    METH_VARARGS, "Calculate DECT-X of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "modbus",      (PyCFunction)_crc16_modbus,    HEXIN_METH_FASTCALL, "Calculate MODBUS of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "modbus_many", (PyCFunction)_crc16_modbus_many, METH_KEYWORDS|METH_VARARGS, "MODBUS of every buffer, modbus_many( buffers, threads=0 ) -> array('H')" },
+    { "usb16",       (PyCFunction)_crc16_usb,       HEXIN_METH_FASTCALL, "Calculate USB of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "ibm",         (PyCFunction)_crc16_ibm,       HEXIN_METH_FASTCALL, "Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "arc",         (PyCFunction)_crc16_ibm,       HEXIN_METH_FASTCALL, "Calculate ARC (Alias:IBM/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "lha",         (PyCFunction)_crc16_ibm,       HEXIN_METH_FASTCALL, "Calculate LHA (Alias:ARC/IBM) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "xmodem",      (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate XMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "zmodem",      (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate ZMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "acorn",       (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate ACORN of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "v41_msb",     (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate V-41-MSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "lte16",       (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate LTE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "ccitt_aug",   (PyCFunction)_crc16_ccitt_aug, HEXIN_METH_FASTCALL, "Calculate CCITT-AUG of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
+    { "spi_fujitsu", (PyCFunction)_crc16_ccitt_aug, HEXIN_METH_FASTCALL, "Calculate SPI-FUJITSU of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
+    { "ccitt_false", (PyCFunction)_crc16_ccitt,     HEXIN_METH_FASTCALL, "Calculate CCITT-FALSE of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "ibm_3740",    (PyCFunction)_crc16_ccitt,     HEXIN_METH_FASTCALL, "Calculate IBM-3740 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "autosar16",   (PyCFunction)_crc16_ccitt,     HEXIN_METH_FASTCALL, "Calculate AUTOSAR of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "kermit",      (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate KERMIT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "ccitt_true",  (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate CCITT-TRUE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "ccitt",       (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate CCITT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "v41_lsb",     (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate V-41-LSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "mcrf4xx",     (PyCFunction)_crc16_mcrf4xx,   HEXIN_METH_FASTCALL, "Calculate MCRF4XX of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "sick",        (PyCFunction)_crc16_sick,      HEXIN_METH_FASTCALL, "Calculate SICK of CRC16 [Poly=0x8005, Init=0x0000]" },
+    { "dnp",         (PyCFunction)_crc16_dnp,       HEXIN_METH_FASTCALL, "Calculate DNP (Ues:M-Bus, ICE870) of CRC16 [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "x25",         (PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate X25 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "ibm_sdlc",    (PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate IBM-SDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "iso_hdlc16",  (PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate ISO-HDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "iec14443_3_b",(PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate ISO-IEC-14443-3-B of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "maxim16",     (PyCFunction)_crc16_maxim,     HEXIN_METH_FASTCALL, "Calculate MAXIM(MAXIM-DOW) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0xFFFF Refin=True Refout=True]" },
+    { "dect_r",      (PyCFunction)_crc16_dect_r,    HEXIN_METH_FASTCALL, "Calculate DECT-R of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0001 Refin=False Refout=False]" },
+    { "dect_x",      (PyCFunction)_crc16_dect_x,    HEXIN_METH_FASTCALL, "Calculate DECT-X of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
     { "table16",     (PyCFunction)_crc16_table,     METH_VARARGS, "Print CRC16 table to list. libscrc.table16( polynomial )" },
-    { "hacker16",    (PyCFunction)_crc16_hacker,    METH_KEYWORDS|METH_VARARGS, "User calculation CRC16\n"
+    { "hacker16",    (PyCFunction)_crc16_hacker,    HEXIN_METH_FASTCALL, "User calculation CRC16\n"
                                                                              "@data   : bytes\n"
                                                                              "@poly   : default=0x1021\n"
                                                                              "@init   : default=0xFFFF\n"
                                                                              "@xorout : default=0x0000\n"
                                                                              "@ref    : default=False" },
-    { "udp",         (PyCFunction)_crc16_network,    METH_VARARGS, "Calculate UDP checksum." },
-    { "tcp",         (PyCFunction)_crc16_network,    METH_VARARGS, "Calculate TCP checksum." },
-    { "fletcher16",  (PyCFunction)_crc16_fletcher,   METH_VARARGS, "Calculate FLETCHER16" },
-    { "epc16",       (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate RFID EPC CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "profibus",    (PyCFunction)_crc16_profibus,   METH_VARARGS, "Calculate PROFIBUS of CRC16 [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "buypass",     (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate BUYPASS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "umts",        (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate UMTS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "verifone",    (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate VERIFONE [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "genibus",     (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate GENIBUS [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "darc",        (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate DARC [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "epc_c1g2",    (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate EPC-C1G2 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "icode16",     (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate I-CODE16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "gsm16",       (PyCFunction)_crc16_gsm16,      METH_VARARGS, "Calculate GSM16 [Poly=0x1021, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "riello",      (PyCFunction)_crc16_riello,     METH_VARARGS, "Calculate RIELLO [Poly=0x1021, Init=0xB2AA Xorout=0x0000 Refin=True Refout=True]" },
-    { "crc16_a",     (PyCFunction)_crc16_crc16_a,    METH_VARARGS, "Calculate CRC16-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
-    { "iec14443_3_a",(PyCFunction)_crc16_crc16_a,    METH_VARARGS, "Calculate ISO-IEC-14443-3-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
-    { "cdma2000",    (PyCFunction)_crc16_cdma2000,   METH_VARARGS, "Calculate CDMA2000 [Poly=0xC867, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "teledisk",    (PyCFunction)_crc16_teledisk,   METH_VARARGS, "Calculate TELEDISK [Poly=0xA097, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "tms37157",    (PyCFunction)_crc16_tms37157,   METH_VARARGS, "Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]" },
-    { "en13757",     (PyCFunction)_crc16_en13757,    METH_VARARGS, "Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "t10_dif",     (PyCFunction)_crc16_t10_dif,    METH_VARARGS, "Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "dds_110",     (PyCFunction)_crc16_dds_110,    METH_VARARGS, "Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]" },
-    { "cms",         (PyCFunction)_crc16_cms,        METH_VARARGS, "Calculate CMS [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "lj1200",      (PyCFunction)_crc16_lj1200,     METH_VARARGS, "Calculate LJ1200 [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "nrsc5",       (PyCFunction)_crc16_nrsc5,      METH_VARARGS, "Calculate NRSC-5 [Poly=0x080B, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "udp",         (PyCFunction)_crc16_network,    HEXIN_METH_FASTCALL, "Calculate UDP checksum." },
+    { "tcp",         (PyCFunction)_crc16_network,    HEXIN_METH_FASTCALL, "Calculate TCP checksum." },
+    { "network_sum",     (PyCFunction)_crc16_network_sum,     HEXIN_METH_FASTCALL, "network_sum(data, previous=0) -> ones' complement sum of data, not inverted" },
+    { "network_combine", (PyCFunction)_crc16_network_combine, METH_VARARGS,        "network_combine(sum_a, sum_b, len_a) -> network_sum of a+b" },
+    { "network_update",  (PyCFunction)_crc16_network_update,  METH_VARARGS,        "network_update(checksum, old_sum, new_sum) -> checksum after a field changed, RFC 1624" },
+    { "fletcher16",  (PyCFunction)_crc16_fletcher,   HEXIN_METH_FASTCALL, "Calculate FLETCHER16" },
+    { "fletcher16_combine", (PyCFunction)_crc16_fletcher16_combine, METH_VARARGS, "fletcher16_combine(fletcher_a, fletcher_b, len_b) -> fletcher16 of a+b" },
+    { "epc16",       (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate RFID EPC CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "profibus",    (PyCFunction)_crc16_profibus,   HEXIN_METH_FASTCALL, "Calculate PROFIBUS of CRC16 [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "buypass",     (PyCFunction)_crc16_buypass,    HEXIN_METH_FASTCALL, "Calculate BUYPASS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "umts",        (PyCFunction)_crc16_buypass,    HEXIN_METH_FASTCALL, "Calculate UMTS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "verifone",    (PyCFunction)_crc16_buypass,    HEXIN_METH_FASTCALL, "Calculate VERIFONE [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "genibus",     (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate GENIBUS [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "darc",        (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate DARC [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "epc_c1g2",    (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate EPC-C1G2 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "icode16",     (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate I-CODE16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "gsm16",       (PyCFunction)_crc16_gsm16,      HEXIN_METH_FASTCALL, "Calculate GSM16 [Poly=0x1021, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "riello",      (PyCFunction)_crc16_riello,     HEXIN_METH_FASTCALL, "Calculate RIELLO [Poly=0x1021, Init=0xB2AA Xorout=0x0000 Refin=True Refout=True]" },
+    { "crc16_a",     (PyCFunction)_crc16_crc16_a,    HEXIN_METH_FASTCALL, "Calculate CRC16-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
+    { "iec14443_3_a",(PyCFunction)_crc16_crc16_a,    HEXIN_METH_FASTCALL, "Calculate ISO-IEC-14443-3-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
+    { "cdma2000",    (PyCFunction)_crc16_cdma2000,   HEXIN_METH_FASTCALL, "Calculate CDMA2000 [Poly=0xC867, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "teledisk",    (PyCFunction)_crc16_teledisk,   HEXIN_METH_FASTCALL, "Calculate TELEDISK [Poly=0xA097, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "tms37157",    (PyCFunction)_crc16_tms37157,   HEXIN_METH_FASTCALL, "Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]" },
+    { "en13757",     (PyCFunction)_crc16_en13757,    HEXIN_METH_FASTCALL, "Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "t10_dif",     (PyCFunction)_crc16_t10_dif,    HEXIN_METH_FASTCALL, "Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "t10_dif_blocks", (PyCFunction)_crc16_t10_dif_blocks, METH_KEYWORDS|METH_VARARGS, "T10-DIF guard of every sector, t10_dif_blocks( data, block_size=512, out=None ) -> array('H')" },
+    { "dds_110",     (PyCFunction)_crc16_dds_110,    HEXIN_METH_FASTCALL, "Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]" },
+    { "cms",         (PyCFunction)_crc16_cms,        HEXIN_METH_FASTCALL, "Calculate CMS [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "lj1200",      (PyCFunction)_crc16_lj1200,     HEXIN_METH_FASTCALL, "Calculate LJ1200 [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "nrsc5",       (PyCFunction)_crc16_nrsc5,      HEXIN_METH_FASTCALL, "Calculate NRSC-5 [Poly=0x080B, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
     
-    { "opensafety_a",   (PyCFunction)_crc16_opensafety_a,   METH_VARARGS, "Calculate OPENSAFETY-A [Poly=0x5935, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "opensafety_b",   (PyCFunction)_crc16_opensafety_b,   METH_VARARGS, "Calculate OPENSAFETY-B [Poly=0x755B, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "opensafety_a",   (PyCFunction)_crc16_opensafety_a,   HEXIN_METH_FASTCALL, "Calculate OPENSAFETY-A [Poly=0x5935, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "opensafety_b",   (PyCFunction)_crc16_opensafety_b,   HEXIN_METH_FASTCALL, "Calculate OPENSAFETY-B [Poly=0x755B, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "_gil_threshold", (PyCFunction)_crc16_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_crc16_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
+    { "_records",       (PyCFunction)_crc16_records,       METH_KEYWORDS|METH_VARARGS, "CRC of every fixed-size record, see libscrc.records()" },
+    { "_cache_info",  (PyCFunction)_crc16_cache_info,  METH_NOARGS, "hacker16 table cache (hits, misses, maxsize, currsize)" },
+    { "_cache_clear", (PyCFunction)_crc16_cache_clear, METH_NOARGS, "Empty the hacker16 table cache and reset its counters" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -822,6 +1524,7 @@ static PyMethodDef _crc16Methods[] = {
 PyDoc_STRVAR( _crc16_doc,
 "Calculation of CRC16 \n"
 "libscrc.modbus     -> Calculate Modbus of CRC16              [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]\n"
+"libscrc.modbus_many -> Modbus of every buffer in a list as array('H'), large lists are split over threads\n"
 "libscrc.usb16      -> Calculate USB    of CRC16              [Poly=0xA001, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]\n"
 "libscrc.ibm        -> Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]\n"
 "libscrc.xmodem     -> Calculate XMODEM of CRC16              [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]\n"
@@ -845,6 +1548,10 @@ PyDoc_STRVAR( _crc16_doc,
 "libscrc.dect_x     -> Calculate DECT-X of CRC16              [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]\n"
 "libscrc.hacker16   -> Free calculation CRC16 (not support python2 series)\n"
 "libscrc.fletcher16 -> Calculate FLETCHER16\n"
+"libscrc.fletcher16_combine -> fletcher16_combine(fletcher_a, fletcher_b, len_b), fletcher16 of a+b\n"
+"libscrc.network_sum     -> network_sum(data, previous=0), ones' complement sum of data before inversion\n"
+"libscrc.network_combine -> network_combine(sum_a, sum_b, len_a), network_sum of a+b\n"
+"libscrc.network_update  -> network_update(checksum, old_sum, new_sum), incremental update ( RFC 1624 )\n"
 "libscrc.epc16      -> Calculate RFID EPC of CRC16           [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]\n"
 "libscrc.profibus   -> Calculate PROFIBUS [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]\n"
 "libscrc.buypass    -> Calculate BUYPASS  [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]\n"
@@ -860,6 +1567,7 @@ PyDoc_STRVAR( _crc16_doc,
 "libscrc.tms37157   -> Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]\n"
 "libscrc.en13757    -> Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]\n"
 "libscrc.t10_dif    -> Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]\n"
+"libscrc.t10_dif_blocks -> T10-DIF guard of every block_size bytes as array('H'), or big-endian into out\n"
 "libscrc.dds_110    -> Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]\n"
 "libscrc.cms        -> Calculate CMS     [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]\n"
 "libscrc.lj1200     -> Calculate LJ1200  [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]\n"
@@ -889,6 +1597,8 @@ PyInit__crc16( void )
 {
     PyObject *m;
 
+    hexin_crc16_params_init();
+
     m = PyModule_Create( &_crc16module );
     if (m == NULL) {
         return NULL;
@@ -906,6 +1616,7 @@ PyInit__crc16( void )
 PyMODINIT_FUNC
 init_crc16( void )
 {
+    hexin_crc16_params_init();
     (void) Py_InitModule3( "_crc16", _crc16Methods, _crc16_doc );
 }
 
@@ -0,0 +1,334 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _crc16simd.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. PCLMULQDQ folding for any 16-bit polynomial.
+*                       2026-10-17 [Heyn] New add the AVX2 multi-buffer kernel, 16 messages side by side.
+*                       2026-10-17 [Heyn] New add the AVX2 Internet checksum sum, 64-bit lanes.
+*                       2026-10-17 [Heyn] New add the AVX2 Fletcher-16 sums.
+*                       2026-10-17 [Heyn] CPUID / XGETBV and the target attributes moved to _modelcpuid.h, only the kernels are left here.
+*
+*   SEE : Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+*
+*********************************************************************************************************
+*/
+
+#include "_crc16simd.h"
+
+#if defined( HEXIN_X86_SIMD )
+
+#include <string.h>
+#include <immintrin.h>
+
+unsigned int hexin_crc16_simd_clmul_support( void )
+{
+    static int support = -1;
+    unsigned int mask  = HEXIN_CPUID_ECX_SSSE3 | HEXIN_CPUID_ECX_PCLMULQDQ;
+
+    if ( support < 0 ) {
+        support = ( ( hexin_cpuid_ecx() & mask ) == mask ) ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+unsigned int hexin_crc16_simd_avx2_support( void )
+{
+    static int support = -1;
+
+    if ( support < 0 ) {
+        support = hexin_cpuid_avx2() ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+/* Same as hexin_crc32_fold128(), the lanes of k come from hexin_crc16_compute_init_fold(). */
+static HEXIN_TARGET_CLMUL __m128i hexin_crc16_fold128( __m128i x, __m128i k )
+{
+    return _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ), _mm_clmulepi64_si128( x, k, 0x11 ) );
+}
+
+HEXIN_TARGET_CLMUL
+unsigned short hexin_crc16_fold_clmul( unsigned short crc16, const unsigned char *pSrc, unsigned int len,
+                                       const struct _hexin_crc16 *param )
+{
+    unsigned int i = 0;
+    unsigned short crc = 0;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param );
+    unsigned char remainder[16];
+    const __m128i bswap = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+    const __m128i k512  = _mm_set_epi64x( ( long long )param->fold[1], ( long long )param->fold[0] );
+    const __m128i k384  = _mm_set_epi64x( ( long long )param->fold[3], ( long long )param->fold[2] );
+    const __m128i k256  = _mm_set_epi64x( ( long long )param->fold[5], ( long long )param->fold[4] );
+    const __m128i k128  = _mm_set_epi64x( ( long long )param->fold[7], ( long long )param->fold[6] );
+    __m128i x0, x1, x2, x3, b0, b1, b2, b3;
+
+    /* The register is the CRC of nothing, so it just gets xored onto the first two bytes. */
+    if ( reflected ) {
+        x0 = _mm_xor_si128( _mm_loadu_si128( ( const __m128i * )pSrc ), _mm_cvtsi32_si128( ( int )crc16 ) );
+    } else {
+        x0 = _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i * )pSrc ), bswap );
+        x0 = _mm_xor_si128( x0, _mm_slli_si128( _mm_cvtsi32_si128( ( int )crc16 ), 14 ) );
+    }
+    pSrc += 16;
+    len  -= 16;
+
+    if ( len >= 112 ) {
+        x1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+        x2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+        x3 = _mm_loadu_si128( ( const __m128i * )( pSrc + 32 ) );
+        if ( !reflected ) {
+            x1 = _mm_shuffle_epi8( x1, bswap );
+            x2 = _mm_shuffle_epi8( x2, bswap );
+            x3 = _mm_shuffle_epi8( x3, bswap );
+        }
+        pSrc += 48;
+        len  -= 48;
+
+        while ( len >= 64 ) {
+            b0 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+            b1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+            b2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 32 ) );
+            b3 = _mm_loadu_si128( ( const __m128i * )( pSrc + 48 ) );
+            if ( !reflected ) {
+                b0 = _mm_shuffle_epi8( b0, bswap );
+                b1 = _mm_shuffle_epi8( b1, bswap );
+                b2 = _mm_shuffle_epi8( b2, bswap );
+                b3 = _mm_shuffle_epi8( b3, bswap );
+            }
+            x0 = _mm_xor_si128( hexin_crc16_fold128( x0, k512 ), b0 );
+            x1 = _mm_xor_si128( hexin_crc16_fold128( x1, k512 ), b1 );
+            x2 = _mm_xor_si128( hexin_crc16_fold128( x2, k512 ), b2 );
+            x3 = _mm_xor_si128( hexin_crc16_fold128( x3, k512 ), b3 );
+            pSrc += 64;
+            len  -= 64;
+        }
+
+        x0 = _mm_xor_si128( hexin_crc16_fold128( x0, k384 ), hexin_crc16_fold128( x1, k256 ) );
+        x0 = _mm_xor_si128( x0, hexin_crc16_fold128( x2, k128 ) );
+        x0 = _mm_xor_si128( x0, x3 );
+    }
+
+    while ( len >= 16 ) {
+        b0 = _mm_loadu_si128( ( const __m128i * )pSrc );
+        if ( !reflected ) {
+            b0 = _mm_shuffle_epi8( b0, bswap );
+        }
+        x0 = _mm_xor_si128( hexin_crc16_fold128( x0, k128 ), b0 );
+        pSrc += 16;
+        len  -= 16;
+    }
+
+    /* x0 is congruent to everything folded so far, its CRC is the register. */
+    if ( !reflected ) {
+        x0 = _mm_shuffle_epi8( x0, bswap );
+    }
+    _mm_storeu_si128( ( __m128i * )remainder, x0 );
+
+    if ( reflected ) {
+        for ( i=0; i<16; i++ ) {
+            crc = ( crc >> 8 ) ^ param->table[ ( crc ^ remainder[i] ) & 0xFF ];
+        }
+        while ( len-- ) {
+            crc = ( crc >> 8 ) ^ param->table[ ( crc ^ *pSrc++ ) & 0xFF ];
+        }
+    } else {
+        for ( i=0; i<16; i++ ) {
+            crc = ( crc << 8 ) ^ param->table[ ( ( crc >> 8 ) ^ remainder[i] ) & 0xFF ];
+        }
+        while ( len-- ) {
+            crc = ( crc << 8 ) ^ param->table[ ( ( crc >> 8 ) ^ *pSrc++ ) & 0xFF ];
+        }
+    }
+
+    return crc;
+}
+
+/* Next four bytes of eight lanes, one 32-bit word per lane in memory order. */
+static HEXIN_TARGET_AVX2 unsigned int hexin_crc16_lane_word( const unsigned char *pSrc )
+{
+    unsigned int word = 0;
+
+    memcpy( &word, pSrc, sizeof( word ) );
+    return word;
+}
+
+static HEXIN_TARGET_AVX2 __m256i hexin_crc16_lanes_load( const unsigned char **pSrc, unsigned int offset )
+{
+    return _mm256_set_epi32( ( int )hexin_crc16_lane_word( pSrc[7] + offset ), ( int )hexin_crc16_lane_word( pSrc[6] + offset ),
+                             ( int )hexin_crc16_lane_word( pSrc[5] + offset ), ( int )hexin_crc16_lane_word( pSrc[4] + offset ),
+                             ( int )hexin_crc16_lane_word( pSrc[3] + offset ), ( int )hexin_crc16_lane_word( pSrc[2] + offset ),
+                             ( int )hexin_crc16_lane_word( pSrc[1] + offset ), ( int )hexin_crc16_lane_word( pSrc[0] + offset ) );
+}
+
+/* Slicing-by-4 on eight lanes, x is the register xored with the next word ( top byte first if MSB-first ). */
+static HEXIN_TARGET_AVX2 __m256i hexin_crc16_lanes_slice( __m256i x, const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected )
+{
+    const __m256i mask = _mm256_set1_epi32( 0xFF );
+    __m256i b0 = _mm256_and_si256( x, mask );
+    __m256i b1 = _mm256_and_si256( _mm256_srli_epi32( x, 8  ), mask );
+    __m256i b2 = _mm256_and_si256( _mm256_srli_epi32( x, 16 ), mask );
+    __m256i b3 = _mm256_srli_epi32( x, 24 );
+
+    if ( reflected ) {
+        x = _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[3], b0, 4 ), _mm256_i32gather_epi32( ( const int * )table[2], b1, 4 ) );
+        return _mm256_xor_si256( x, _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[1], b2, 4 ),
+                                                      _mm256_i32gather_epi32( ( const int * )table[0], b3, 4 ) ) );
+    }
+    x = _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[3], b3, 4 ), _mm256_i32gather_epi32( ( const int * )table[2], b2, 4 ) );
+    return _mm256_xor_si256( x, _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[1], b1, 4 ),
+                                                  _mm256_i32gather_epi32( ( const int * )table[0], b0, 4 ) ) );
+}
+
+/*
+ * len bytes of HEXIN_CRC16_LANES independent messages, two groups of eight lanes interleaved to
+ * hide the gather latency. crc holds the raw registers, pSrc moves past the bytes taken, len is a
+ * multiple of 4. table[j] is the CRC of a byte followed by j zero bytes, widened to 32 bits.
+ */
+HEXIN_TARGET_AVX2
+void hexin_crc16_multi_avx2( unsigned int *crc, const unsigned char **pSrc, unsigned int len,
+                             const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected )
+{
+    const __m256i bswap = _mm256_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                           12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+    __m256i x0 = _mm256_loadu_si256( ( const __m256i * )( crc + 0 ) );
+    __m256i x1 = _mm256_loadu_si256( ( const __m256i * )( crc + 8 ) );
+    __m256i w0, w1;
+    unsigned int i = 0, l = 0;
+
+    for ( i=0; i<len; i+=4 ) {
+        w0 = hexin_crc16_lanes_load( pSrc + 0, i );
+        w1 = hexin_crc16_lanes_load( pSrc + 8, i );
+        if ( reflected ) {
+            x0 = _mm256_xor_si256( x0, w0 );
+            x1 = _mm256_xor_si256( x1, w1 );
+        } else {
+            x0 = _mm256_xor_si256( _mm256_slli_epi32( x0, 16 ), _mm256_shuffle_epi8( w0, bswap ) );
+            x1 = _mm256_xor_si256( _mm256_slli_epi32( x1, 16 ), _mm256_shuffle_epi8( w1, bswap ) );
+        }
+        x0 = hexin_crc16_lanes_slice( x0, table, reflected );
+        x1 = hexin_crc16_lanes_slice( x1, table, reflected );
+    }
+
+    _mm256_storeu_si256( ( __m256i * )( crc + 0 ), x0 );
+    _mm256_storeu_si256( ( __m256i * )( crc + 8 ), x1 );
+    for ( l=0; l<HEXIN_CRC16_LANES; l++ ) {
+        pSrc[l] += len;
+    }
+}
+
+/*
+ * Ones' complement sum of whole 64-byte blocks, 64-bit lanes. Each lane adds the two 32-bit halves
+ * of its quadword, 2^32 = 1 mod 65535 so that is the same sum as the 16-bit words, no carry to track.
+ */
+HEXIN_TARGET_AVX2
+unsigned long long hexin_network_avx2( unsigned long long sum, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned int blocks = len / HEXIN_NETWORK_AVX2_BLOCK;
+    const __m256i low = _mm256_set1_epi64x( 0xFFFFFFFFLL );
+    __m256i s0 = _mm256_setzero_si256(), s1 = _mm256_setzero_si256();
+    __m256i b0, b1;
+    __m128i h;
+
+    while ( blocks-- ) {
+        b0 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 0  ) );
+        b1 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 32 ) );
+        s0 = _mm256_add_epi64( s0, _mm256_add_epi64( _mm256_and_si256( b0, low ), _mm256_srli_epi64( b0, 32 ) ) );
+        s1 = _mm256_add_epi64( s1, _mm256_add_epi64( _mm256_and_si256( b1, low ), _mm256_srli_epi64( b1, 32 ) ) );
+        pSrc += HEXIN_NETWORK_AVX2_BLOCK;
+    }
+
+    s0 = _mm256_add_epi64( s0, s1 );
+    h  = _mm_add_epi64( _mm256_castsi256_si128( s0 ), _mm256_extracti128_si256( s0, 1 ) );
+    h  = _mm_add_epi64( h, _mm_unpackhi_epi64( h, h ) );
+    return sum + ( unsigned long long )_mm_cvtsi128_si64( h );
+}
+
+/*
+ * Fletcher-16 sums over whole 64-byte blocks, as the Adler-32 ones in _crc32simd.c: sum2 gains
+ * ( 64 - k ) times byte k of a block, plus 64 times the sum1 of the blocks before ( ps ).
+ * fletcher holds sum1 | sum2 << 8, both taken mod 255 every HEXIN_FLETCHER16_NMAX bytes.
+ */
+HEXIN_TARGET_AVX2
+unsigned short hexin_fletcher16_avx2( unsigned short fletcher, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned int sum1 = ( fletcher & 0xFF ) % HEXIN_MOD_FLETCHER16, sum2 = ( fletcher >> 8 ) % HEXIN_MOD_FLETCHER16;
+    unsigned int blocks = len / HEXIN_FLETCHER16_AVX2_BLOCK, n = 0;
+    const __m256i tap1 = _mm256_setr_epi8( 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49,
+                                           48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33 );
+    const __m256i tap2 = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                           16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16( 1 );
+    __m256i ps, s1, s2, b0, b1;
+    __m128i h1, h2;
+
+    while ( blocks > 0 ) {
+        n = ( blocks < HEXIN_FLETCHER16_NMAX / HEXIN_FLETCHER16_AVX2_BLOCK ) ? blocks : HEXIN_FLETCHER16_NMAX / HEXIN_FLETCHER16_AVX2_BLOCK;
+        blocks -= n;
+
+        ps = _mm256_setr_epi32( ( int )( sum1 * n ), 0, 0, 0, 0, 0, 0, 0 );
+        s2 = _mm256_setr_epi32( ( int )sum2, 0, 0, 0, 0, 0, 0, 0 );
+        s1 = _mm256_setzero_si256();
+        do {
+            b0 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 0  ) );
+            b1 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 32 ) );
+            ps = _mm256_add_epi32( ps, s1 );
+            s1 = _mm256_add_epi32( s1, _mm256_add_epi64( _mm256_sad_epu8( b0, zero ), _mm256_sad_epu8( b1, zero ) ) );
+            s2 = _mm256_add_epi32( s2, _mm256_madd_epi16( _mm256_maddubs_epi16( b0, tap1 ), ones ) );
+            s2 = _mm256_add_epi32( s2, _mm256_madd_epi16( _mm256_maddubs_epi16( b1, tap2 ), ones ) );
+            pSrc += HEXIN_FLETCHER16_AVX2_BLOCK;
+        } while ( --n );
+        s2 = _mm256_add_epi32( s2, _mm256_slli_epi32( ps, 6 ) );
+
+        h1 = _mm_add_epi32( _mm256_castsi256_si128( s1 ), _mm256_extracti128_si256( s1, 1 ) );
+        h2 = _mm_add_epi32( _mm256_castsi256_si128( s2 ), _mm256_extracti128_si256( s2, 1 ) );
+        h1 = _mm_add_epi32( h1, _mm_shuffle_epi32( h1, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        h1 = _mm_add_epi32( h1, _mm_shuffle_epi32( h1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        h2 = _mm_add_epi32( h2, _mm_shuffle_epi32( h2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        h2 = _mm_add_epi32( h2, _mm_shuffle_epi32( h2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        sum1 = ( sum1 + ( unsigned int )_mm_cvtsi128_si32( h1 ) ) % HEXIN_MOD_FLETCHER16;
+        sum2 = ( unsigned int )_mm_cvtsi128_si32( h2 ) % HEXIN_MOD_FLETCHER16;
+    }
+    return ( unsigned short )( sum1 | ( sum2 << 8 ) );
+}
+
+#else
+
+unsigned int hexin_crc16_simd_clmul_support( void )
+{
+    return FALSE;
+}
+
+unsigned int hexin_crc16_simd_avx2_support( void )
+{
+    return FALSE;
+}
+
+unsigned short hexin_crc16_fold_clmul( unsigned short crc16, const unsigned char *pSrc, unsigned int len,
+                                       const struct _hexin_crc16 *param )
+{
+    return crc16;
+}
+
+void hexin_crc16_multi_avx2( unsigned int *crc, const unsigned char **pSrc, unsigned int len,
+                             const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected )
+{
+}
+
+unsigned long long hexin_network_avx2( unsigned long long sum, const unsigned char *pSrc, unsigned int len )
+{
+    return sum;
+}
+
+unsigned short hexin_fletcher16_avx2( unsigned short fletcher, const unsigned char *pSrc, unsigned int len )
+{
+    return fletcher;
+}
+
+#endif /* HEXIN_X86_SIMD */
@@ -0,0 +1,57 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _crc16simd.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize.
+*                       2026-10-17 [Heyn] New add the AVX2 multi-buffer kernel.
+*                       2026-10-17 [Heyn] New add the AVX2 Internet checksum sum.
+*                       2026-10-17 [Heyn] New add the AVX2 Fletcher-16 sums.
+*                       2026-10-17 [Heyn] HEXIN_X86_SIMD and the CPUID helpers come from _modelcpuid.h.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __CRC16_SIMD_H__
+#define __CRC16_SIMD_H__
+
+#include "_crc16tables.h"
+
+#include "_modelcpuid.h"
+
+/* Below this size the table loop is faster than setting up the folds. */
+#define                 HEXIN_CRC16_FOLD_MINSIZE                64
+
+/* Messages computed side by side by hexin_crc16_multi_avx2(). */
+#define                 HEXIN_CRC16_LANES                       16
+
+/* From this size a message is faster on its own through the folds than in a lane. */
+#define                 HEXIN_CRC16_MULTI_MAXSIZE               128
+
+/* Messages sorted by length at a time, lanes are filled from neighbours in that order. */
+#define                 HEXIN_CRC16_MULTI_CHUNK                 1024
+
+/* Bytes per loop of the Internet checksum vector sum, shorter buffers stay scalar. */
+#define                 HEXIN_NETWORK_AVX2_BLOCK                64
+
+/* Bytes per loop of the Fletcher-16 vector sums. */
+#define                 HEXIN_FLETCHER16_AVX2_BLOCK             64
+
+unsigned int hexin_crc16_simd_clmul_support( void );
+unsigned int hexin_crc16_simd_avx2_support( void );
+
+unsigned short hexin_crc16_fold_clmul( unsigned short crc16, const unsigned char *pSrc, unsigned int len,
+                                       const struct _hexin_crc16 *param );
+
+void hexin_crc16_multi_avx2( unsigned int *crc, const unsigned char **pSrc, unsigned int len,
+                             const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected );
+
+unsigned long long hexin_network_avx2( unsigned long long sum, const unsigned char *pSrc, unsigned int len );
+unsigned short hexin_fletcher16_avx2( unsigned short fletcher, const unsigned char *pSrc, unsigned int len );
+
+#endif //__CRC16_SIMD_H__
@@ -14,11 +14,44 @@
 *                       2020-03-13 [Heyn] New add hacker code.
 *                       2020-03-20 [Heyn] New add hexin_calc_crc16_network.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] Split out hexin_crc16_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] New add hacker table cache, least recently used entry is replaced.
+*                       2026-10-17 [Heyn] New add PCLMULQDQ folding dispatch and hexin_crc16_compute_blocks().
+*                       2026-10-17 [Heyn] New add hexin_crc16_compute_many(), short messages go through the AVX2 lanes.
+*                       2026-10-17 [Heyn] New add hexin_crc16_fletcher_combine().
+*                       2026-10-17 [Heyn] hexin_calc_crc16_network() sums 64 bits at a time ( AVX2 ), New add the partial sum / combine / RFC 1624 update.
+*                       2026-10-17 [Heyn] hexin_calc_crc16_fletcher() takes the modulo once per block ( AVX2 / HEXIN_FLETCHER16_NMAX bytes ).
+*                       2026-10-17 [Heyn] hexin_crc16_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
+*                       2026-10-17 [Heyn] hexin_crc16_compute_blocks() takes a 64-bit length, only every block is below 4 GB.
+*                       2026-10-17 [Heyn] Fix sick / fletcher over 4 GB, 64-bit lengths, network takes a 64-bit length.
+*                       2026-10-17 [Heyn] Fix fletcher over 4 GB with AVX2, the vector sums run in 1 GB pieces.
+*                       2026-10-17 [Heyn] Fix network_sum() over 4 GB, 1 GB pieces folded in between.
 *
 *********************************************************************************************************
 */
 
+#include <stdlib.h>
+#include <string.h>
 #include "_crc16tables.h"
+#include "_crc16simd.h"
+
+#if defined( HEXIN_CONST_TABLES )
+#include "_crc16const.h"
+
+static const struct _hexin_crc16_const *hexin_crc16_const_lookup( const struct _hexin_crc16 *param )
+{
+    const struct _hexin_crc16_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_crc16_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
 
 unsigned short hexin_reverse16( unsigned short data )
 {
@@ -107,9 +140,9 @@ static unsigned short __hexin_crc16_sick( unsigned short crc16, unsigned char c,
     return crc;
 }
 
-unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned int len, unsigned short crc16 )
+unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned long long len, unsigned short crc16 )
 {
-    unsigned int   i            = 0;
+    unsigned long long i        = 0;
 			 char  prev_byte	= 0x00;
 	unsigned short crc		    = crc16;
 
@@ -121,40 +154,131 @@ unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned int le
 	return crc;
 }
 
-unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ )
+unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, unsigned long long len, unsigned short crc16 /*reserved*/ )
+{
+    return ( unsigned short )( ~hexin_crc16_network_fold( hexin_crc16_network_sum( 0, pSrc, len ) ) );
+}
+
+/*
+ * Ones' complement sum of the native 16-bit words, not folded nor inverted. A trailing odd byte is
+ * added as it is. Eight bytes at a time as two 32-bit halves, they fold to the same 16-bit sum and a
+ * 64-bit accumulator cannot overflow on an unsigned int length.
+ */
+static unsigned long long hexin_crc16_network_piece( unsigned long long sum, const unsigned char *pSrc, unsigned int len )
 {
-    unsigned int sum = 0;
+    unsigned int size = 0;
+    unsigned int half[2];
+    unsigned short word = 0;
+
+    if ( ( len >= HEXIN_NETWORK_AVX2_BLOCK ) && hexin_crc16_simd_avx2_support() ) {
+        size = len - len % HEXIN_NETWORK_AVX2_BLOCK;
+        sum  = hexin_network_avx2( sum, pSrc, size );
+        pSrc += size;
+        len  -= size;
+    }
+
+    while ( len >= 8 ) {
+        memcpy( half, pSrc, 8 );
+        sum  += ( unsigned long long )half[0] + half[1];
+        len  -= 8;
+        pSrc += 8;
+    }
 
     while ( len > 1 ) {
-        sum  += *( unsigned short * )pSrc;
+        memcpy( &word, pSrc, 2 );
+        sum  += word;
         len  -= 2;
         pSrc += 2;
     }
- 
+
     if ( len ) {
-        sum += *(unsigned char *) pSrc;
+        sum += *pSrc;
     }
- 
+    return sum;
+}
+
+/* Any length, HEXIN_NETWORK_SLICE bytes at a time with the sum folded to 33 bits in between. */
+unsigned long long hexin_crc16_network_sum( unsigned long long sum, const unsigned char *pSrc, unsigned long long len )
+{
+    while ( len > HEXIN_NETWORK_SLICE ) {
+        sum   = hexin_crc16_network_piece( sum, pSrc, HEXIN_NETWORK_SLICE );
+        sum   = ( sum >> 32 ) + ( sum & 0xFFFFFFFF );
+        pSrc += HEXIN_NETWORK_SLICE;
+        len  -= HEXIN_NETWORK_SLICE;
+    }
+    return hexin_crc16_network_piece( sum, pSrc, ( unsigned int )len );
+}
+
+/* End-around carry down to 16 bits, 0 only when sum is. */
+unsigned short hexin_crc16_network_fold( unsigned long long sum )
+{
     while ( sum >> 16 ) {
         sum = ( sum >> 16 ) + ( sum & 0xFFFF );
     }
- 
-    return ( unsigned short )( ~sum );
+    return ( unsigned short )sum;
 }
 
-unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ )
+/*
+ * Folded sum of a+b from sum1 of a, sum2 of b and len1 = len( a ). After an odd number of bytes
+ * the words of b straddle the ones of a+b, the same bytes in the other halves: sum2 is swapped ( RFC 1071 ).
+ */
+unsigned short hexin_crc16_network_combine( unsigned short sum1, unsigned short sum2, unsigned long long len1 )
 {
-    unsigned int i = 0;
-    unsigned short sum1 = 0, sum2 = 0;
+    if ( len1 & 1 ) {
+        sum2 = ( unsigned short )( ( sum2 << 8 ) | ( sum2 >> 8 ) );
+    }
+    return hexin_crc16_network_fold( ( unsigned long long )sum1 + sum2 );
+}
+
+/* RFC 1624 eqn. 3, HC' = ~( ~HC + ~m + m' ), the checksum once a field summing to old_sum sums to new_sum. */
+unsigned short hexin_crc16_network_update( unsigned short check, unsigned short old_sum, unsigned short new_sum )
+{
+    unsigned long long sum = ( unsigned long long )( unsigned short )~check + ( unsigned short )~old_sum + new_sum;
+
+    return ( unsigned short )( ~hexin_crc16_network_fold( sum ) );
+}
 
-    for ( i = 0; i < len; i++ ) {
-        sum1 = ( sum1 + pSrc[i] ) % 255;
-        sum2 = ( sum2 + sum1 ) % 255;
+/* Same sums mod 255 as taken byte by byte, only once every HEXIN_FLETCHER16_NMAX bytes ( AVX2 blocks first ). */
+unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned long long len, unsigned short crc16 /*reserved*/ )
+{
+    unsigned int sum1 = 0, sum2 = 0;
+    unsigned int size = 0, fletcher = 0;
+
+    /* The vector sums go in unsigned int pieces of whole blocks, each one carries on from the last. */
+    if ( ( len >= HEXIN_FLETCHER16_AVX2_BLOCK ) && hexin_crc16_simd_avx2_support() ) {
+        while ( len >= HEXIN_FLETCHER16_AVX2_BLOCK ) {
+            size     = ( len < HEXIN_FLETCHER16_SLICE ) ? ( unsigned int )( len - len % HEXIN_FLETCHER16_AVX2_BLOCK ) : HEXIN_FLETCHER16_SLICE;
+            fletcher = hexin_fletcher16_avx2( ( unsigned short )fletcher, pSrc, size );
+            pSrc    += size;
+            len     -= size;
+        }
+        sum1 = fletcher & 0xFF;
+        sum2 = fletcher >> 8;
+    }
+
+    while ( len > 0 ) {
+        size = ( len < HEXIN_FLETCHER16_NMAX ) ? ( unsigned int )len : HEXIN_FLETCHER16_NMAX;
+        len -= size;
+        while ( size-- ) {
+            sum1 += *pSrc++;
+            sum2 += sum1;
+        }
+        sum1 %= HEXIN_MOD_FLETCHER16;
+        sum2 %= HEXIN_MOD_FLETCHER16;
     }
-    return ( sum1 & 0xFF ) | ( sum2 << 8 );
+    return ( unsigned short )( sum1 | ( sum2 << 8 ) );
 }
 
-static unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param )
+/* Fletcher-16 of a+b from fletcher1 of a, fletcher2 of b and len2 = len( b ), sum2 gains sum1 of a once per byte of b. */
+unsigned short hexin_crc16_fletcher_combine( unsigned short fletcher1, unsigned short fletcher2, unsigned long long len2 )
+{
+    unsigned int sum1 = ( ( fletcher1 & 0xFF ) + ( fletcher2 & 0xFF ) ) % 255;
+    unsigned int sum2 = ( ( fletcher1 >> 8 ) + ( fletcher2 >> 8 ) + ( unsigned int )( len2 % 255 ) * ( fletcher1 & 0xFF ) ) % 255;
+
+    return ( unsigned short )( sum1 | ( sum2 << 8 ) );
+}
+
+static unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param, unsigned short polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned short crc = 0, c = 0;
@@ -164,28 +288,63 @@ static unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param )
             crc = 0;
             c   = ( unsigned short ) i;
             for ( j=0; j<8; j++ ) {
-                if ( (crc ^ c) & 0x0001 )   crc = ( crc >> 1 ) ^ param->poly;
+                if ( (crc ^ c) & 0x0001 )   crc = ( crc >> 1 ) ^ polynomial;
                 else                        crc =   crc >> 1;
                 c = c >> 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c   = ( ( unsigned short ) i ) << 8;
             for ( j=0; j<8; j++ ) {
-                if ( (crc ^ c) & 0x8000 ) crc = ( crc << 1 ) ^ param->poly;
+                if ( (crc ^ c) & 0x8000 ) crc = ( crc << 1 ) ^ polynomial;
                 else                      crc =   crc << 1;
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     }
+    param->table = param->table_buffer;
     return TRUE;
 }
 
-static unsigned short hexin_crc16_compute_char( unsigned short crc16, unsigned char c, struct _hexin_crc16 *param )
+/*
+ * x^n mod ( x^16 + polynomial ), polynomial in MSB-first form.
+ */
+static unsigned short hexin_crc16_xpow_mod( unsigned int n, unsigned short polynomial )
+{
+    unsigned short r = 0x0001;
+
+    while ( n-- ) {
+        if ( r & 0x8000 ) r = ( r << 1 ) ^ polynomial;
+        else              r = ( r << 1 );
+    }
+    return r;
+}
+
+/* Fold constants, laid out as in hexin_crc32_compute_init_fold(). */
+static void hexin_crc16_compute_init_fold( struct _hexin_crc16 *param )
+{
+    static const unsigned int distance[HEXIN_CRC16_FOLD_ARRAY/2] = { 512, 384, 256, 128 };
+    unsigned int i = 0;
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        for ( i=0; i<HEXIN_CRC16_FOLD_ARRAY/2; i++ ) {
+            param->fold_buffer[2*i+0] = ( unsigned long long )hexin_reverse16( hexin_crc16_xpow_mod( distance[i] + 63, param->poly ) ) << 48;
+            param->fold_buffer[2*i+1] = ( unsigned long long )hexin_reverse16( hexin_crc16_xpow_mod( distance[i] - 1,  param->poly ) ) << 48;
+        }
+    } else {
+        for ( i=0; i<HEXIN_CRC16_FOLD_ARRAY/2; i++ ) {
+            param->fold_buffer[2*i+0] = hexin_crc16_xpow_mod( distance[i],      param->poly );
+            param->fold_buffer[2*i+1] = hexin_crc16_xpow_mod( distance[i] + 64, param->poly );
+        }
+    }
+    param->fold = param->fold_buffer;
+}
+
+static unsigned short hexin_crc16_compute_char( unsigned short crc16, unsigned char c, const struct _hexin_crc16 *param )
 {
     unsigned short crc = crc16;
 
@@ -198,25 +357,278 @@ static unsigned short hexin_crc16_compute_char( unsigned short crc16, unsigned c
     return crc;
 }
 
-unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc16 *param )
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_crc16_compute_init( struct _hexin_crc16 *param )
 {
-    unsigned int i = 0;
-    unsigned short crc = param->init;
+    unsigned short poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_crc16_const *entry = NULL;
+#endif
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = hexin_reverse16( param->poly );
-        }
-        param->is_initial = hexin_crc16_compute_init_table( param );
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
     }
 
-    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) { 
-        crc = hexin_reverse16( param->init );
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_crc16_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->fold  = entry->fold;
+        param->is_initial = TRUE;
+        return TRUE;
+    }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        poly = hexin_reverse16( param->poly );
+    }
+    hexin_crc16_compute_init_fold( param );
+    param->is_initial = hexin_crc16_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+/* Run the raw register over pSrc, no init or xorout is applied. */
+unsigned short hexin_crc16_update( unsigned short crc16, const unsigned char *pSrc, unsigned int len, const struct _hexin_crc16 *param )
+{
+    unsigned int i = 0;
+    unsigned short crc = crc16;
+
+    if ( ( len >= HEXIN_CRC16_FOLD_MINSIZE ) && hexin_crc16_simd_clmul_support() ) {
+        return hexin_crc16_fold_clmul( crc, pSrc, len, param );
     }
 
 	for ( i=0; i<len; i++ ) {
 		crc = hexin_crc16_compute_char( crc, pSrc[i], param );
 	}
+    return crc;
+}
+
+unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc16 *param )
+{
+    unsigned short crc = param->init;
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) { 
+        crc = hexin_reverse16( param->init );
+    }
+
+    while ( len > HEXIN_CRC16_UPDATE_MAXSIZE ) {
+        crc   = hexin_crc16_update( crc, pSrc, HEXIN_CRC16_UPDATE_MAXSIZE, param );
+        pSrc += HEXIN_CRC16_UPDATE_MAXSIZE;
+        len  -= HEXIN_CRC16_UPDATE_MAXSIZE;
+    }
+    crc = hexin_crc16_update( crc, pSrc, ( unsigned int )len, param );
     
 	return ( crc ^ param->xorout );
 }
+
+/* One CRC per block_size bytes, len is a multiple of block_size. */
+void hexin_crc16_compute_blocks( const unsigned char *pSrc, unsigned long long len, unsigned int block_size,
+                                 const struct _hexin_crc16 *param, unsigned short *result )
+{
+    unsigned long long i = 0;
+
+    for ( i=0; i<len/block_size; i++ ) {
+        result[i] = hexin_crc16_compute( pSrc + i * block_size, block_size, param );
+    }
+}
+
+struct _hexin_crc16_lane {
+    unsigned int len;
+    unsigned int index;
+};
+
+static int hexin_crc16_lane_compare( const void *a, const void *b )
+{
+    unsigned int x = ( ( const struct _hexin_crc16_lane * )a )->len;
+    unsigned int y = ( ( const struct _hexin_crc16_lane * )b )->len;
+
+    return ( x > y ) - ( x < y );
+}
+
+/* Slicing-by-4 tables for the lanes, table[j] is the CRC of a byte followed by j zero bytes. */
+static void hexin_crc16_init_lanes( unsigned int (*table)[MAX_TABLE_ARRAY], const struct _hexin_crc16 *param )
+{
+    unsigned int i = 0, j = 0, crc = 0;
+
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        table[0][i] = param->table[i];
+    }
+    for ( j=1; j<4; j++ ) {
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = table[j - 1][i];
+            if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+                table[j][i] = ( crc >> 8 ) ^ param->table[crc & 0xFF];
+            } else {
+                table[j][i] = ( ( crc << 8 ) & 0xFFFF ) ^ param->table[( crc >> 8 ) & 0xFF];
+            }
+        }
+    }
+}
+
+/*
+ * CRC of count independent messages. Short ones are sorted by length and run HEXIN_CRC16_LANES at a
+ * time for the length of the shortest in the group, each then finishes its own tail.
+ */
+void hexin_crc16_compute_many( const unsigned char *const *pSrc, const unsigned int *len, unsigned int count,
+                               const struct _hexin_crc16 *param, unsigned short *result )
+{
+    unsigned int table[4][MAX_TABLE_ARRAY];
+    struct _hexin_crc16_lane order[HEXIN_CRC16_MULTI_CHUNK];
+    const unsigned char *lane[HEXIN_CRC16_LANES];
+    unsigned int crc[HEXIN_CRC16_LANES];
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+    unsigned short init = reflected ? hexin_reverse16( param->init ) : param->init;
+    unsigned int base = 0, size = 0, n = 0, i = 0, l = 0, shortest = 0, sorted = TRUE;
+
+    if ( ( count < HEXIN_CRC16_LANES ) || !hexin_crc16_simd_avx2_support() ) {
+        for ( i=0; i<count; i++ ) {
+            result[i] = hexin_crc16_compute( pSrc[i], len[i], param );
+        }
+        return;
+    }
+
+    hexin_crc16_init_lanes( table, param );
+
+    for ( base=0; base<count; base+=size ) {
+        size   = ( count - base < HEXIN_CRC16_MULTI_CHUNK ) ? ( count - base ) : HEXIN_CRC16_MULTI_CHUNK;
+        sorted = TRUE;
+        for ( i=0, n=0; i<size; i++ ) {
+            if ( len[base + i] >= HEXIN_CRC16_MULTI_MAXSIZE ) {
+                result[base + i] = hexin_crc16_compute( pSrc[base + i], len[base + i], param );
+                continue;
+            }
+            order[n].len   = len[base + i];
+            order[n].index = base + i;
+            if ( ( n > 0 ) && ( order[n].len < order[n - 1].len ) ) {
+                sorted = FALSE;
+            }
+            n++;
+        }
+        if ( !sorted ) {
+            qsort( order, n, sizeof( order[0] ), hexin_crc16_lane_compare );
+        }
+
+        for ( i=0; i+HEXIN_CRC16_LANES<=n; i+=HEXIN_CRC16_LANES ) {
+            for ( l=0; l<HEXIN_CRC16_LANES; l++ ) {
+                lane[l] = pSrc[order[i + l].index];
+                crc[l]  = init;
+            }
+            shortest = order[i].len & ~3U;
+            hexin_crc16_multi_avx2( crc, lane, shortest, ( const unsigned int (*)[MAX_TABLE_ARRAY] )table, reflected );
+            for ( l=0; l<HEXIN_CRC16_LANES; l++ ) {
+                result[order[i + l].index] = hexin_crc16_update( ( unsigned short )crc[l], lane[l], order[i + l].len - shortest, param ) ^ param->xorout;
+            }
+        }
+        for ( ; i<n; i++ ) {
+            result[order[i].index] = hexin_crc16_compute( pSrc[order[i].index], order[i].len, param );
+        }
+    }
+}
+
+/*
+ * Tables built for hacker parameters, keyed by ( width, poly, refin, refout ).
+ * There is no lock, the module only calls in here with the GIL held. An entry in
+ * use by a computation running without the GIL is never replaced.
+ */
+static struct _hexin_crc16_cache {
+    unsigned int        valid;
+    unsigned int        refs;
+    unsigned long long  used;
+    struct _hexin_crc16  param;
+} hexin_crc16_cache[HEXIN_CRC16_CACHE_SIZE];
+
+static unsigned long long hexin_crc16_cache_tick   = 0;
+static unsigned long long hexin_crc16_cache_hits   = 0;
+static unsigned long long hexin_crc16_cache_misses = 0;
+
+/*
+ * Point param at a cached table, building it on a miss. Returns the handle to pass to
+ * hexin_crc16_cache_release(), or 0 when every entry is in use and param got its own table.
+ */
+unsigned int hexin_crc16_cache_acquire( struct _hexin_crc16 *param )
+{
+    struct _hexin_crc16_cache *slot  = NULL;
+    struct _hexin_crc16_cache *entry = NULL;
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC16_CACHE_SIZE; i++ ) {
+        entry = &hexin_crc16_cache[i];
+        if ( entry->valid && ( entry->param.width == param->width ) && ( entry->param.poly   == param->poly  )
+                          && ( entry->param.refin == param->refin ) && ( entry->param.refout == param->refout ) ) {
+            slot = entry;
+            break;
+        }
+    }
+
+    if ( slot != NULL ) {
+        hexin_crc16_cache_hits++;
+    } else {
+        hexin_crc16_cache_misses++;
+        for ( i=0; i<HEXIN_CRC16_CACHE_SIZE; i++ ) {
+            entry = &hexin_crc16_cache[i];
+            if ( entry->refs != 0 ) {
+                continue;
+            }
+            if ( !entry->valid ) {
+                slot = entry;
+                break;
+            }
+            if ( ( slot == NULL ) || ( entry->used < slot->used ) ) {
+                slot = entry;
+            }
+        }
+
+        if ( slot == NULL ) {
+            hexin_crc16_compute_init( param );
+            return 0;
+        }
+
+        slot->valid             = FALSE;
+        slot->param.is_initial  = FALSE;
+        slot->param.width       = param->width;
+        slot->param.poly        = param->poly;
+        slot->param.refin       = param->refin;
+        slot->param.refout      = param->refout;
+        slot->valid = hexin_crc16_compute_init( &slot->param );
+    }
+
+    slot->used = ++hexin_crc16_cache_tick;
+    slot->refs++;
+    param->table = slot->param.table;
+    param->fold  = slot->param.fold;
+    param->is_initial = TRUE;
+    return ( unsigned int )( slot - hexin_crc16_cache ) + 1;
+}
+
+void hexin_crc16_cache_release( unsigned int handle )
+{
+    if ( ( handle > 0 ) && ( handle <= HEXIN_CRC16_CACHE_SIZE ) && ( hexin_crc16_cache[handle - 1].refs > 0 ) ) {
+        hexin_crc16_cache[handle - 1].refs--;
+    }
+}
+
+void hexin_crc16_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count )
+{
+    unsigned int i = 0;
+
+    *hits   = hexin_crc16_cache_hits;
+    *misses = hexin_crc16_cache_misses;
+    *count  = 0;
+    for ( i=0; i<HEXIN_CRC16_CACHE_SIZE; i++ ) {
+        *count += hexin_crc16_cache[i].valid ? 1 : 0;
+    }
+}
+
+/* Drops every entry not in use and resets the counters. */
+void hexin_crc16_cache_clear( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC16_CACHE_SIZE; i++ ) {
+        if ( hexin_crc16_cache[i].refs == 0 ) {
+            hexin_crc16_cache[i].valid = FALSE;
+        }
+    }
+    hexin_crc16_cache_hits   = 0;
+    hexin_crc16_cache_misses = 0;
+}
@@ -11,6 +11,17 @@
 *		New Create at 	2017-09-19 21:01PM [Heyn] New CRC16-X25 Table.
 *                       2020-03-13 16:10PM [Heyn] New add hacker code.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] New add hexin_crc16_compute_init().
+*                       2026-10-17 [Heyn] Catalogue tables come from the generated _crc16const.h.
+*                       2026-10-17 [Heyn] New add hacker table cache.
+*                       2026-10-17 [Heyn] New add PCLMULQDQ fold constants, hexin_crc16_update() and hexin_crc16_compute_blocks().
+*                       2026-10-17 [Heyn] New add hexin_crc16_compute_many(), short messages go through the AVX2 lanes.
+*                       2026-10-17 [Heyn] New add hexin_crc16_fletcher_combine().
+*                       2026-10-17 [Heyn] New add hexin_crc16_network_sum() / _fold() / _combine() / _update().
+*                       2026-10-17 [Heyn] New add HEXIN_FLETCHER16_NMAX.
+*                       2026-10-17 [Heyn] sick / network / fletcher take a 64-bit length.
+*                       2026-10-17 [Heyn] New add HEXIN_FLETCHER16_SLICE.
+*                       2026-10-17 [Heyn] hexin_crc16_network_sum() takes a 64-bit length, New add HEXIN_NETWORK_SLICE.
 *
 *********************************************************************************************************
 */
@@ -32,6 +43,26 @@
 
 #define                 HEXIN_CRC16_WIDTH                       16
 
+/* Number of hacker parameter tables kept by hexin_crc16_cache_acquire(). */
+#ifndef HEXIN_CRC16_CACHE_SIZE
+#define                 HEXIN_CRC16_CACHE_SIZE                  16
+#endif
+
+#define                 HEXIN_CRC16_FOLD_ARRAY                  8
+
+/* hexin_crc16_compute() feeds hexin_crc16_update() at most this many bytes at a time. */
+#define                 HEXIN_CRC16_UPDATE_MAXSIZE              0x40000000
+
+/* Largest n with 255 * n * ( n + 1 ) / 2 + 254 * ( n + 1 ) < 2^32, bytes the Fletcher-16 sums can take between two modulos. */
+#define                 HEXIN_MOD_FLETCHER16                    255
+#define                 HEXIN_FLETCHER16_NMAX                   5802
+
+/* Largest piece handed to the Fletcher-16 vector sums, whole AVX2 blocks. */
+#define                 HEXIN_FLETCHER16_SLICE                  0x40000000
+
+/* hexin_crc16_network_sum() works through this many bytes ( even ) between two folds of its sum. */
+#define                 HEXIN_NETWORK_SLICE                     0x40000000
+
 #define                 CRC16_POLYNOMIAL_1021                   0x1021
 #define                 CRC16_POLYNOMIAL_8005                   0x8005
 #define                 CRC16_POLYNOMIAL_0589                   0x0589
@@ -52,7 +83,19 @@ struct _hexin_crc16 {
     unsigned int    refout;
     unsigned short  xorout;
     unsigned short  result;
-    unsigned short  table[MAX_TABLE_ARRAY];
+    const unsigned short  *table;
+    const unsigned long long  *fold;
+    unsigned short  table_buffer[MAX_TABLE_ARRAY];
+    unsigned long long  fold_buffer[HEXIN_CRC16_FOLD_ARRAY];
+};
+
+/* One entry of the generated _crc16const.h ( see src/gentables.py ). */
+struct _hexin_crc16_const {
+    unsigned int  width;
+    unsigned short  poly;
+    unsigned int  reflected;
+    const unsigned short  *table;
+    const unsigned long long  *fold;
 };
 
 unsigned short hexin_reverse16( unsigned short data );
@@ -60,11 +103,27 @@ unsigned short hexin_reverse16( unsigned short data );
 unsigned int hexin_crc16_init_table_poly_is_high( unsigned short polynomial, unsigned short *table );
 unsigned int hexin_crc16_init_table_poly_is_low(  unsigned short polynomial, unsigned short *table );
 
-unsigned short hexin_calc_crc16_sick(     const unsigned char *pSrc, unsigned int len, unsigned short crc16 );
-unsigned short hexin_calc_crc16_network(  const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ );
-unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ );
+unsigned short hexin_calc_crc16_sick(     const unsigned char *pSrc, unsigned long long len, unsigned short crc16 );
+unsigned short hexin_calc_crc16_network(  const unsigned char *pSrc, unsigned long long len, unsigned short crc16 /*reserved*/ );
+unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned long long len, unsigned short crc16 /*reserved*/ );
+unsigned long long hexin_crc16_network_sum( unsigned long long sum, const unsigned char *pSrc, unsigned long long len );
+unsigned short hexin_crc16_network_fold( unsigned long long sum );
+unsigned short hexin_crc16_network_combine( unsigned short sum1, unsigned short sum2, unsigned long long len1 );
+unsigned short hexin_crc16_network_update( unsigned short check, unsigned short old_sum, unsigned short new_sum );
+unsigned short hexin_crc16_fletcher_combine( unsigned short fletcher1, unsigned short fletcher2, unsigned long long len2 );
+
+unsigned int   hexin_crc16_compute_init( struct _hexin_crc16 *param );
+unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc16 *param );
+unsigned short hexin_crc16_update( unsigned short crc16, const unsigned char *pSrc, unsigned int len, const struct _hexin_crc16 *param );
+void hexin_crc16_compute_blocks( const unsigned char *pSrc, unsigned long long len, unsigned int block_size,
+                                 const struct _hexin_crc16 *param, unsigned short *result );
+void hexin_crc16_compute_many( const unsigned char *const *pSrc, const unsigned int *len, unsigned int count,
+                               const struct _hexin_crc16 *param, unsigned short *result );
 
-unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc16 *param );
+unsigned int hexin_crc16_cache_acquire( struct _hexin_crc16 *param );
+void hexin_crc16_cache_release( unsigned int handle );
+void hexin_crc16_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count );
+void hexin_crc16_cache_clear( void );
 
 
 #endif //__CRC16_TABLES_H__
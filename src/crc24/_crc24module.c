@@ -10,34 +10,65 @@
 * ---------------
 *		New Create at 	2020-04-17 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+*                       2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+*                       2026-10-17 [Heyn] hacker24 tables come from an LRU cache, New add _cache_info() / _cache_clear().
+*                       2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+*                       2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+*                       2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+*                       2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
 *
 ********************************************************************************************************
 */
 
 #include <Python.h>
 #include "_crc24tables.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc24 *param )
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_crc24 *param, unsigned int *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned int )value;
+        } else {
+            *result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -45,153 +76,170 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc24_ble( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_ble = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC24_WIDTH,
+                                               .poly   = CRC24_POLYNOMIAL_00065B,
+                                               .init   = 0x00555555,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x00000000,
+                                               .result = 0 };
+
+static PyObject * _crc24_ble( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_ble = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC24_WIDTH,
-                                                   .poly   = CRC24_POLYNOMIAL_00065B,
-                                                   .init   = 0x00555555,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00000000,
-                                                   .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_ble ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_ble, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_ble.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_flexraya( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_flexraya = { .is_initial=FALSE,
+                                                    .width  = HEXIN_CRC24_WIDTH,
+                                                    .poly   = CRC24_POLYNOMIAL_5D6DCB,
+                                                    .init   = 0x00FEDCBA,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x00000000,
+                                                    .result = 0 };
+
+static PyObject * _crc24_flexraya( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_flexraya = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC24_WIDTH,
-                                                        .poly   = CRC24_POLYNOMIAL_5D6DCB,
-                                                        .init   = 0x00FEDCBA,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00000000,
-                                                        .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_flexraya ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_flexraya, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_flexraya.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_flexrayb( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_flexrayb = { .is_initial=FALSE,
+                                                    .width  = HEXIN_CRC24_WIDTH,
+                                                    .poly   = CRC24_POLYNOMIAL_5D6DCB,
+                                                    .init   = 0x00ABCDEF,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x00000000,
+                                                    .result = 0 };
+
+static PyObject * _crc24_flexrayb( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_flexrayb = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC24_WIDTH,
-                                                        .poly   = CRC24_POLYNOMIAL_5D6DCB,
-                                                        .init   = 0x00ABCDEF,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00000000,
-                                                        .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_flexrayb ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_flexrayb, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_flexrayb.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_openpgp( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_openpgp = { .is_initial=FALSE,
+                                                   .width  = HEXIN_CRC24_WIDTH,
+                                                   .poly   = CRC24_POLYNOMIAL_864CFB,
+                                                   .init   = 0x00B704CE,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x00000000,
+                                                   .result = 0 };
+
+static PyObject * _crc24_openpgp( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_openpgp = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC24_WIDTH,
-                                                       .poly   = CRC24_POLYNOMIAL_864CFB,
-                                                       .init   = 0x00B704CE,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x00000000,
-                                                       .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_openpgp ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_openpgp, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_openpgp.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_lte_a( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_lte_a = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC24_WIDTH,
+                                                 .poly   = CRC24_POLYNOMIAL_864CFB,
+                                                 .init   = 0x00000000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x00000000,
+                                                 .result = 0 };
+
+static PyObject * _crc24_lte_a( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_lte_a = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC24_WIDTH,
-                                                     .poly   = CRC24_POLYNOMIAL_864CFB,
-                                                     .init   = 0x00000000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_lte_a ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_lte_a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_lte_a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_lte_b( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_lte_b = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC24_WIDTH,
+                                                 .poly   = CRC24_POLYNOMIAL_800063,
+                                                 .init   = 0x00000000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x00000000,
+                                                 .result = 0 };
+
+static PyObject * _crc24_lte_b( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_lte_b = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC24_WIDTH,
-                                                     .poly   = CRC24_POLYNOMIAL_800063,
-                                                     .init   = 0x00000000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_lte_b ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_lte_b, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_lte_b.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_os9( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_os9 = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC24_WIDTH,
+                                               .poly   = CRC24_POLYNOMIAL_800063,
+                                               .init   = 0x00FFFFFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00FFFFFF,
+                                               .result = 0 };
+
+static PyObject * _crc24_os9( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_os9 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC24_WIDTH,
-                                                   .poly   = CRC24_POLYNOMIAL_800063,
-                                                   .init   = 0x00FFFFFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00FFFFFF,
-                                                   .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_os9 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_os9, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_os9.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_interlaken( PyObject *self, PyObject *args )
+static struct _hexin_crc24 crc24_param_interlaken = { .is_initial=FALSE,
+                                                      .width  = HEXIN_CRC24_WIDTH,
+                                                      .poly   = CRC24_POLYNOMIAL_328B63,
+                                                      .init   = 0x00FFFFFF,
+                                                      .refin  = FALSE,
+                                                      .refout = FALSE,
+                                                      .xorout = 0x00FFFFFF,
+                                                      .result = 0 };
+
+static PyObject * _crc24_interlaken( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_interlaken = { .is_initial=FALSE,
-                                                          .width  = HEXIN_CRC24_WIDTH,
-                                                          .poly   = CRC24_POLYNOMIAL_328B63,
-                                                          .init   = 0x00FFFFFF,
-                                                          .refin  = FALSE,
-                                                          .refout = FALSE,
-                                                          .xorout = 0x00FFFFFF,
-                                                          .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_interlaken ) ) {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc24_param_interlaken, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_interlaken.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc24_hacker( HEXIN_FASTCALL_PARAMS )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int cache = 0;
     struct _hexin_crc24 crc24_param_hacker = { .is_initial=FALSE,
                                                .width  = 24,
                                                .poly   = CRC24_POLYNOMIAL_800063,
@@ -200,60 +248,149 @@ static PyObject * _crc24_hacker( PyObject *self, PyObject *args, PyObject* kws )
                                                .refout = FALSE,
                                                .xorout = 0x00FFFFFF,
                                                .result = 0 };
+    unsigned long long poly   = crc24_param_hacker.poly;
+    unsigned long long init   = crc24_param_hacker.init;
+    unsigned long long xorout = crc24_param_hacker.xorout;
+    PyObject *slots[6];
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    static const char *const kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|IIIpp", kwlist, &data,
-                                                                      &crc24_param_hacker.poly,
-                                                                      &crc24_param_hacker.init,
-                                                                      &crc24_param_hacker.xorout,
-                                                                      &crc24_param_hacker.refin,
-                                                                      &crc24_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;        
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 6, slots )
+      || !hexin_PyArg_Mask( slots[1], &poly ) || !hexin_PyArg_Mask( slots[2], &init ) || !hexin_PyArg_Mask( slots[3], &xorout )
+      || !hexin_PyArg_Bool( slots[4], &crc24_param_hacker.refin ) || !hexin_PyArg_Bool( slots[5], &crc24_param_hacker.refout )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
+        return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|IIIpp", kwlist, &data,
-                                                                      &crc24_param_hacker.poly,
-                                                                      &crc24_param_hacker.init,
-                                                                      &crc24_param_hacker.xorout,
-                                                                      &crc24_param_hacker.refin,
-                                                                      &crc24_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;  
+    crc24_param_hacker.poly   = ( unsigned int )poly;
+    crc24_param_hacker.init   = ( unsigned int )init;
+    crc24_param_hacker.xorout = ( unsigned int )xorout;
+
+    cache = hexin_crc24_cache_acquire( &crc24_param_hacker );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        crc24_param_hacker.result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc24_param_hacker );
+        Py_END_ALLOW_THREADS
+    } else {
+        crc24_param_hacker.result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc24_param_hacker );
     }
-#endif /* PY_MAJOR_VERSION */
-
-    crc24_param_hacker.result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc24_param_hacker );
     
+    hexin_crc24_cache_release( cache );
+
     if ( data.obj )
        PyBuffer_Release( &data );
 
-    return Py_BuildValue( "I", crc24_param_hacker.result );
+    return PyLong_FromUnsignedLong( crc24_param_hacker.result );
+}
+
+static PyObject * _crc24_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
+        return NULL;
+    }
+
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+static PyObject * _crc24_cache_info( PyObject *self, PyObject *args )
+{
+    unsigned long long hits = 0, misses = 0;
+    unsigned int count = 0;
+
+    hexin_crc24_cache_info( &hits, &misses, &count );
+    return Py_BuildValue( "KKII", hits, misses, ( unsigned int )HEXIN_CRC24_CACHE_SIZE, count );
+}
+
+static PyObject * _crc24_cache_clear( PyObject *self, PyObject *args )
+{
+    hexin_crc24_cache_clear();
+    Py_RETURN_NONE;
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_crc24_catalogue {
+    const char          *name;
+    struct _hexin_crc24  *param;
+} hexin_crc24_params[] = {
+    { "ble",        &crc24_param_ble },
+    { "flexraya",   &crc24_param_flexraya },
+    { "flexrayb",   &crc24_param_flexrayb },
+    { "openpgp",    &crc24_param_openpgp },
+    { "crc24",      &crc24_param_openpgp },
+    { "lte_a",      &crc24_param_lte_a },
+    { "lte_b",      &crc24_param_lte_b },
+    { "os9",        &crc24_param_os9 },
+    { "interlaken", &crc24_param_interlaken },
+    { NULL, NULL }
+};
+
+static void hexin_crc24_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_crc24_params[i].name != NULL; i++ ) {
+        hexin_crc24_compute_init( hexin_crc24_params[i].param );
+    }
+}
+
+static PyObject * _crc24_catalogue( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( pdict == NULL ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc24_params[i].name != NULL; i++ ) {
+        param = hexin_crc24_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_crc24_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
 }
 
 /* method table */
 static PyMethodDef _crc24Methods[] = {
-    { "ble",         (PyCFunction)_crc24_ble,        METH_VARARGS,   "Calculate BLE of CRC24 [Poly=0x00065B, Init=0x555555, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "flexraya",    (PyCFunction)_crc24_flexraya,   METH_VARARGS,   "Calculate FLEXRAY-A of CRC24 [Poly=0x5D6DCB, Init=0xFEDCBA, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "flexrayb",    (PyCFunction)_crc24_flexrayb,   METH_VARARGS,   "Calculate FLEXRAY-B of CRC24 [Poly=0x5D6DCB, Init=0xABCDEF, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "openpgp",     (PyCFunction)_crc24_openpgp,    METH_VARARGS,   "Calculate OPENPGP of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "crc24",       (PyCFunction)_crc24_openpgp,    METH_VARARGS,   "Calculate CRC of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "lte_a",       (PyCFunction)_crc24_lte_a,      METH_VARARGS,   "Calculate LTE-A of CRC24 [Poly=0x864CFB, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "lte_b",       (PyCFunction)_crc24_lte_b,      METH_VARARGS,   "Calculate LTE-B of CRC24 [Poly=0x800063, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "os9",         (PyCFunction)_crc24_os9,        METH_VARARGS,   "Calculate OS-9 of CRC24 [Poly=0x800063, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
-    { "interlaken",  (PyCFunction)_crc24_interlaken, METH_VARARGS,   "Calculate INTERLAKEN of CRC24 [Poly=0x328B63, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
-    { "hacker24",    (PyCFunction)_crc24_hacker,     METH_KEYWORDS|METH_VARARGS, "User calculation CRC24\n"
+    { "ble",         (PyCFunction)_crc24_ble,        HEXIN_METH_FASTCALL,   "Calculate BLE of CRC24 [Poly=0x00065B, Init=0x555555, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "flexraya",    (PyCFunction)_crc24_flexraya,   HEXIN_METH_FASTCALL,   "Calculate FLEXRAY-A of CRC24 [Poly=0x5D6DCB, Init=0xFEDCBA, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "flexrayb",    (PyCFunction)_crc24_flexrayb,   HEXIN_METH_FASTCALL,   "Calculate FLEXRAY-B of CRC24 [Poly=0x5D6DCB, Init=0xABCDEF, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "openpgp",     (PyCFunction)_crc24_openpgp,    HEXIN_METH_FASTCALL,   "Calculate OPENPGP of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "crc24",       (PyCFunction)_crc24_openpgp,    HEXIN_METH_FASTCALL,   "Calculate CRC of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "lte_a",       (PyCFunction)_crc24_lte_a,      HEXIN_METH_FASTCALL,   "Calculate LTE-A of CRC24 [Poly=0x864CFB, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "lte_b",       (PyCFunction)_crc24_lte_b,      HEXIN_METH_FASTCALL,   "Calculate LTE-B of CRC24 [Poly=0x800063, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "os9",         (PyCFunction)_crc24_os9,        HEXIN_METH_FASTCALL,   "Calculate OS-9 of CRC24 [Poly=0x800063, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
+    { "interlaken",  (PyCFunction)_crc24_interlaken, HEXIN_METH_FASTCALL,   "Calculate INTERLAKEN of CRC24 [Poly=0x328B63, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
+    { "hacker24",    (PyCFunction)_crc24_hacker,     HEXIN_METH_FASTCALL, "User calculation CRC24\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0xEDB88320\n"
                                                                                  "@init   : default=0xFFFFFFFF\n"
                                                                                  "@xorout : default=0x00000000\n"
                                                                                  "@ref    : default=False" },
+    { "_gil_threshold", (PyCFunction)_crc24_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_crc24_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
+    { "_cache_info",  (PyCFunction)_crc24_cache_info,  METH_NOARGS, "hacker24 table cache (hits, misses, maxsize, currsize)" },
+    { "_cache_clear", (PyCFunction)_crc24_cache_clear, METH_NOARGS, "Empty the hacker24 table cache and reset its counters" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -289,6 +426,8 @@ PyInit__crc24( void )
 {
     PyObject *m;
 
+    hexin_crc24_params_init();
+
     m = PyModule_Create( &_crc24module );
     if ( m == NULL ) {
         return NULL;
@@ -306,6 +445,7 @@ PyInit__crc24( void )
 PyMODINIT_FUNC
 init_crc24( void )
 {
+    hexin_crc24_params_init();
     ( void ) Py_InitModule3( "_crc24", _crc24Methods, _crc24_doc );
 }
 
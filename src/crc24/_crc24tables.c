@@ -10,12 +10,33 @@
 * ---------------
 *		New Create at 	2020-04-17 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] Split out hexin_crc24_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] New add hacker table cache, least recently used entry is replaced.
+*                       2026-10-17 [Heyn] hexin_crc24_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
 *
 *********************************************************************************************************
 */
 
 #include "_crc24tables.h"
 
+#if defined( HEXIN_CONST_TABLES )
+#include "_crc24const.h"
+
+static const struct _hexin_crc24_const *hexin_crc24_const_lookup( const struct _hexin_crc24 *param )
+{
+    const struct _hexin_crc24_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_crc24_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
+
 static unsigned int hexin_reverse24( unsigned int data )
 {
     unsigned int i = 0;
@@ -26,7 +47,7 @@ static unsigned int hexin_reverse24( unsigned int data )
     return t;
 }
 
-unsigned int hexin_crc24_compute_init_table( struct _hexin_crc24 *param )
+unsigned int hexin_crc24_compute_init_table( struct _hexin_crc24 *param, unsigned int polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned int crc = 0x00000000L;
@@ -36,27 +57,28 @@ unsigned int hexin_crc24_compute_init_table( struct _hexin_crc24 *param )
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = i;
             for ( j=0; j<8; j++ ) {
-                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ param->poly;
+                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ polynomial;
                 else                     crc = ( crc >> 1 );
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c	= ( ( unsigned int )i ) << 16;
             for ( j=0; j<8; j++ ) {
-                if ( ( crc ^ c ) & 0x00800000L )  crc = ( crc << 1 ) ^ param->poly;
+                if ( ( crc ^ c ) & 0x00800000L )  crc = ( crc << 1 ) ^ polynomial;
                 else                              crc = ( crc << 1 );
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     }
+    param->table = param->table_buffer;
     return TRUE;
 }
 
-unsigned int hexin_crc24_compute_char( unsigned int crc24, unsigned char c, struct _hexin_crc24 *param )
+unsigned int hexin_crc24_compute_char( unsigned int crc24, unsigned char c, const struct _hexin_crc24 *param )
 {
     unsigned int crc = crc24;
 
@@ -69,17 +91,38 @@ unsigned int hexin_crc24_compute_char( unsigned int crc24, unsigned char c, stru
     return crc;
 }
 
-unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc24 *param )
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_crc24_compute_init( struct _hexin_crc24 *param )
 {
-    unsigned int i = 0;
-    unsigned int crc = param->init;
+    unsigned int poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_crc24_const *entry = NULL;
+#endif
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = hexin_reverse24( param->poly );
-        }
-        param->is_initial = hexin_crc24_compute_init_table( param );
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
+    }
+
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_crc24_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->is_initial = TRUE;
+        return TRUE;
     }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        poly = hexin_reverse24( param->poly );
+    }
+    param->is_initial = hexin_crc24_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc24 *param )
+{
+    unsigned long long i = 0;
+    unsigned int crc = param->init;
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
         crc = hexin_reverse24( param->init );
@@ -91,3 +134,110 @@ unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned int len, s
     
 	return ( ( crc & 0xFFFFFF ) ^ param->xorout ); 
 }
+
+/*
+ * Tables built for hacker parameters, keyed by ( width, poly, refin, refout ).
+ * There is no lock, the module only calls in here with the GIL held. An entry in
+ * use by a computation running without the GIL is never replaced.
+ */
+static struct _hexin_crc24_cache {
+    unsigned int        valid;
+    unsigned int        refs;
+    unsigned long long  used;
+    struct _hexin_crc24  param;
+} hexin_crc24_cache[HEXIN_CRC24_CACHE_SIZE];
+
+static unsigned long long hexin_crc24_cache_tick   = 0;
+static unsigned long long hexin_crc24_cache_hits   = 0;
+static unsigned long long hexin_crc24_cache_misses = 0;
+
+/*
+ * Point param at a cached table, building it on a miss. Returns the handle to pass to
+ * hexin_crc24_cache_release(), or 0 when every entry is in use and param got its own table.
+ */
+unsigned int hexin_crc24_cache_acquire( struct _hexin_crc24 *param )
+{
+    struct _hexin_crc24_cache *slot  = NULL;
+    struct _hexin_crc24_cache *entry = NULL;
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC24_CACHE_SIZE; i++ ) {
+        entry = &hexin_crc24_cache[i];
+        if ( entry->valid && ( entry->param.width == param->width ) && ( entry->param.poly   == param->poly  )
+                          && ( entry->param.refin == param->refin ) && ( entry->param.refout == param->refout ) ) {
+            slot = entry;
+            break;
+        }
+    }
+
+    if ( slot != NULL ) {
+        hexin_crc24_cache_hits++;
+    } else {
+        hexin_crc24_cache_misses++;
+        for ( i=0; i<HEXIN_CRC24_CACHE_SIZE; i++ ) {
+            entry = &hexin_crc24_cache[i];
+            if ( entry->refs != 0 ) {
+                continue;
+            }
+            if ( !entry->valid ) {
+                slot = entry;
+                break;
+            }
+            if ( ( slot == NULL ) || ( entry->used < slot->used ) ) {
+                slot = entry;
+            }
+        }
+
+        if ( slot == NULL ) {
+            hexin_crc24_compute_init( param );
+            return 0;
+        }
+
+        slot->valid             = FALSE;
+        slot->param.is_initial  = FALSE;
+        slot->param.width       = param->width;
+        slot->param.poly        = param->poly;
+        slot->param.refin       = param->refin;
+        slot->param.refout      = param->refout;
+        slot->valid = hexin_crc24_compute_init( &slot->param );
+    }
+
+    slot->used = ++hexin_crc24_cache_tick;
+    slot->refs++;
+    param->table = slot->param.table;
+    param->is_initial = TRUE;
+    return ( unsigned int )( slot - hexin_crc24_cache ) + 1;
+}
+
+void hexin_crc24_cache_release( unsigned int handle )
+{
+    if ( ( handle > 0 ) && ( handle <= HEXIN_CRC24_CACHE_SIZE ) && ( hexin_crc24_cache[handle - 1].refs > 0 ) ) {
+        hexin_crc24_cache[handle - 1].refs--;
+    }
+}
+
+void hexin_crc24_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count )
+{
+    unsigned int i = 0;
+
+    *hits   = hexin_crc24_cache_hits;
+    *misses = hexin_crc24_cache_misses;
+    *count  = 0;
+    for ( i=0; i<HEXIN_CRC24_CACHE_SIZE; i++ ) {
+        *count += hexin_crc24_cache[i].valid ? 1 : 0;
+    }
+}
+
+/* Drops every entry not in use and resets the counters. */
+void hexin_crc24_cache_clear( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC24_CACHE_SIZE; i++ ) {
+        if ( hexin_crc24_cache[i].refs == 0 ) {
+            hexin_crc24_cache[i].valid = FALSE;
+        }
+    }
+    hexin_crc24_cache_hits   = 0;
+    hexin_crc24_cache_misses = 0;
+}
@@ -10,6 +10,9 @@
 * ---------------
 *		New Create at 	2020-04-17 [Heyn] Initialize.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] New add hexin_crc24_compute_init().
+*                       2026-10-17 [Heyn] Catalogue tables come from the generated _crc24const.h.
+*                       2026-10-17 [Heyn] New add hacker table cache.
 *
 *********************************************************************************************************
 */
@@ -31,6 +34,11 @@
 
 #define                 HEXIN_CRC24_WIDTH                       24
 
+/* Number of hacker parameter tables kept by hexin_crc24_cache_acquire(). */
+#ifndef HEXIN_CRC24_CACHE_SIZE
+#define                 HEXIN_CRC24_CACHE_SIZE                  16
+#endif
+
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x800000L )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 
@@ -51,9 +59,24 @@ struct _hexin_crc24 {
     unsigned int  refout;
     unsigned int  xorout;
     unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
+    const unsigned int  *table;
+    unsigned int  table_buffer[MAX_TABLE_ARRAY];
 };
 
-unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc24 *param );
+/* One entry of the generated _crc24const.h ( see src/gentables.py ). */
+struct _hexin_crc24_const {
+    unsigned int  width;
+    unsigned int  poly;
+    unsigned int  reflected;
+    const unsigned int  *table;
+};
+
+unsigned int hexin_crc24_compute_init( struct _hexin_crc24 *param );
+unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc24 *param );
+
+unsigned int hexin_crc24_cache_acquire( struct _hexin_crc24 *param );
+void hexin_crc24_cache_release( unsigned int handle );
+void hexin_crc24_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count );
+void hexin_crc24_cache_clear( void );
 
 #endif //__CRC24_TABLES_H__
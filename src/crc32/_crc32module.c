@@ -16,6 +16,20 @@
  *                      2020-03-20 [Heyn] New add adler32 and fletcher32 functions.
  *                      2020-04-17 [Heyn] Issues #1
  *                      2020-04-26 [Heyn] Optimized Code
+ *                      2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+ *                      2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+ *                      2026-10-17 [Heyn] hacker32 tables come from an LRU cache, New add _cache_info() / _cache_clear().
+ *                      2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+ *                      2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+ *                      2026-10-17 [Heyn] New add _records(), one CRC per fixed-size record behind libscrc.records().
+ *                      2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+ *                      2026-10-17 [Heyn] adler32 takes the previous value as init, SIMD sums with the NMAX deferred modulo.
+ *                      2026-10-17 [Heyn] New add adler32_combine() / fletcher32_combine(), threads=N for adler32 / fletcher32.
+ *                      2026-10-17 [Heyn] fletcher32 goes through hexin_crc32_fletcher_sums() / _final(), threads=N stays bit-identical.
+ *                      2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+ *                      2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
+ *                      2026-10-17 [Heyn] Fix adler32 / fletcher32 over 4 GB, slices of at most 1 GB and a 64-bit length for finish.
+ *                      2026-10-17 [Heyn] Fix adler32_combine() / fletcher32_combine(), negative or 2**64 and larger arguments raise rather than wrap.
  * 
  * Web : https://en.wikipedia.org/wiki/Polynomial_representations_of_cyclic_redundancy_checks
  *
@@ -24,33 +38,124 @@
 
 #include <Python.h>
 #include "_crc32tables.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
+#include "_crc32simd.h"
+
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+/* Longest slice handed to one checksum call, the sums take an unsigned int length. Even. */
+#define                 HEXIN_CHECKSUM_SLICE_MAXSIZE            0x40000000ULL
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+/* Slices of one checksum over worker threads, combined in order afterwards. */
+struct _hexin_checksum_slices {
+    const unsigned char    *pSrc;
+    unsigned long long      len;
+    unsigned long long      slice;
+    unsigned int            init;
+    unsigned int            start;
+    unsigned int          (*function)( const unsigned char *, unsigned int, unsigned int );
+    unsigned int           *values;
+};
 
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+static void hexin_checksum_slices_run( void *arg, Py_ssize_t begin, Py_ssize_t end )
+{
+    struct _hexin_checksum_slices *slices = ( struct _hexin_checksum_slices * )arg;
+    unsigned long long offset = 0, size = 0;
+
+    for ( ; begin<end; begin++ ) {
+        offset = ( unsigned long long )begin * slices->slice;
+        size   = ( slices->len - offset < slices->slice ) ? ( slices->len - offset ) : slices->slice;
+        slices->values[begin] = (* slices->function)( slices->pSrc + offset, ( unsigned int )size,
+                                                      ( begin == 0 ) ? slices->init : slices->start );
+    }
+}
+
+/*
+ * adler32 / fletcher32( data, init, threads=1 ). With threads != 1 large buffers are cut into
+ * slices of an even size ( Fletcher-32 words stay whole ), every slice after the first starts
+ * from start and the results are merged with combine. Slices are at most HEXIN_CHECKSUM_SLICE_MAXSIZE,
+ * so long buffers get more slices than threads, on one thread too. finish, when given, turns the
+ * merged value into the result with the whole buffer at hand.
+ */
+static unsigned char hexin_PyArg_ParseTuple( HEXIN_FASTCALL_PARAMS,
                                              unsigned int init,
                                              unsigned int (*function)( const unsigned char *,
                                                                        unsigned int,
                                                                        unsigned int ),
+                                             unsigned int start,
+                                             unsigned int (*combine)( unsigned int, unsigned int, unsigned long long ),
+                                             unsigned int (*finish)( unsigned int, const unsigned char *, unsigned long long ),
                                              unsigned int *result )
 {
     Py_buffer data = { NULL, NULL };
+    PyObject *slots[3];
+    unsigned long long value = init;
+    unsigned int threads = 1;
+    const struct _hexin_model_capi *capi = NULL;
+    struct _hexin_checksum_slices slices = { NULL };
+    Py_ssize_t i = 0, n = 1, count = 0;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "", "", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 2, slots ) || !hexin_PyArg_Mask( slots[1], &value )
+      || !hexin_PyArg_Threads( slots[2], &threads ) || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
+    init = ( unsigned int )value;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
+    }
+
+    if ( capi != NULL ) {
+        n = ( Py_ssize_t )capi->threads( ( unsigned long long )data.len, threads );
+    }
+
+    if ( ( n > 1 ) || ( ( unsigned long long )data.len > HEXIN_CHECKSUM_SLICE_MAXSIZE ) ) {
+        slices.pSrc     = ( const unsigned char * )data.buf;
+        slices.len      = ( unsigned long long )data.len;
+        slices.slice    = ( ( slices.len + n - 1 ) / n + 1 ) & ~1ULL;
+        slices.slice    = ( slices.slice > HEXIN_CHECKSUM_SLICE_MAXSIZE ) ? HEXIN_CHECKSUM_SLICE_MAXSIZE : slices.slice;
+        slices.init     = init;
+        slices.start    = start;
+        slices.function = function;
+        count = ( Py_ssize_t )( ( slices.len + slices.slice - 1 ) / slices.slice );
+        slices.values   = PyMem_New( unsigned int, count );
+        if ( slices.values == NULL ) {
+            if ( data.obj )
+               PyBuffer_Release( &data );
+            PyErr_NoMemory();
+            return FALSE;
         }
-        return FALSE;
+
+        Py_BEGIN_ALLOW_THREADS
+        if ( n > 1 ) {
+            capi->parallel_for( hexin_checksum_slices_run, &slices, count, ( unsigned int )n );
+        } else {
+            hexin_checksum_slices_run( &slices, 0, count );
+        }
+        *result = slices.values[0];
+        for ( i=1; i<count; i++ ) {
+            *result = (* combine)( *result, slices.values[i], ( i < count - 1 ) ? slices.slice : slices.len - i * slices.slice );
+        }
+        Py_END_ALLOW_THREADS
+
+        PyMem_Free( slices.values );
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
     }
-#endif /* PY_MAJOR_VERSION */
 
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+    if ( finish != NULL ) {
+        *result = (* finish)( *result, (const unsigned char *)data.buf, (unsigned long long)data.len );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -58,27 +163,43 @@ static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
     return TRUE;
 }
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc32 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_crc32 *param, unsigned int *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned int )value;
+        } else {
+            *result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -86,40 +207,44 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc32_mpeg_2( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_param_mpeg2 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0xFFFFFFFFL,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x00000000L,
+                                                 .result = 0 };
+
+static PyObject * _crc32_mpeg_2( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_mpeg2 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000L,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_mpeg2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_mpeg2, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_mpeg2.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_param_crc32 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0xFFFFFFFFL,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0xFFFFFFFFL,
+                                                 .result = 0 };
+
+static PyObject * _crc32_crc32( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_crc32 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_crc32 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_crc32, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_crc32.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc32_table( PyObject *self, PyObject *args )
@@ -144,15 +269,16 @@ static PyObject * _crc32_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "I", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc32_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc32_hacker( HEXIN_FASTCALL_PARAMS )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int cache = 0;
     struct _hexin_crc32 crc32_param_hacker = { .is_initial=FALSE,
                                                .width  = HEXIN_CRC32_WIDTH,
                                                .poly   = CRC32_POLYNOMIAL_04C11DB7,
@@ -161,286 +287,646 @@ static PyObject * _crc32_hacker( PyObject *self, PyObject *args, PyObject* kws )
                                                .refout = TRUE,
                                                .xorout = 0xFFFFFFFFL,
                                                .result = 0 };
+    unsigned long long poly   = crc32_param_hacker.poly;
+    unsigned long long init   = crc32_param_hacker.init;
+    unsigned long long xorout = crc32_param_hacker.xorout;
+    PyObject *slots[6];
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    static const char *const kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|IIIpp", kwlist, &data,
-                                                                      &crc32_param_hacker.poly,
-                                                                      &crc32_param_hacker.init,
-                                                                      &crc32_param_hacker.xorout,
-                                                                      &crc32_param_hacker.refin,
-                                                                      &crc32_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;        
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 6, slots )
+      || !hexin_PyArg_Mask( slots[1], &poly ) || !hexin_PyArg_Mask( slots[2], &init ) || !hexin_PyArg_Mask( slots[3], &xorout )
+      || !hexin_PyArg_Bool( slots[4], &crc32_param_hacker.refin ) || !hexin_PyArg_Bool( slots[5], &crc32_param_hacker.refout )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
+        return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|IIIpp", kwlist, &data,
-                                                                      &crc32_param_hacker.poly,
-                                                                      &crc32_param_hacker.init,
-                                                                      &crc32_param_hacker.xorout,
-                                                                      &crc32_param_hacker.refin,
-                                                                      &crc32_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;  
+    crc32_param_hacker.poly   = ( unsigned int )poly;
+    crc32_param_hacker.init   = ( unsigned int )init;
+    crc32_param_hacker.xorout = ( unsigned int )xorout;
+
+    cache = hexin_crc32_cache_acquire( &crc32_param_hacker );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        crc32_param_hacker.result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc32_param_hacker );
+        Py_END_ALLOW_THREADS
+    } else {
+        crc32_param_hacker.result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc32_param_hacker );
     }
-#endif /* PY_MAJOR_VERSION */
 
-    crc32_param_hacker.result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc32_param_hacker );
+    hexin_crc32_cache_release( cache );
 
     if ( data.obj )
        PyBuffer_Release( &data );
 
-    return Py_BuildValue( "I", crc32_param_hacker.result );
+    return PyLong_FromUnsignedLong( crc32_param_hacker.result );
 }
 
 
-static PyObject * _crc32_adler32( PyObject *self, PyObject *args )
+static PyObject * _crc32_adler32( HEXIN_FASTCALL_PARAMS )
 {
-    unsigned int result   = 0x00000000L;
-    unsigned int reserved = 0x00000000L;
+    unsigned int result = 0x00000000L;
+    unsigned int init   = 0x00000001L;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc32_adler, ( unsigned int * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, init, hexin_calc_crc32_adler,
+                                  0x00000001L, hexin_crc32_adler_combine, NULL, ( unsigned int * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_fletcher32( PyObject *self, PyObject *args )
+static PyObject * _crc32_fletcher32( HEXIN_FASTCALL_PARAMS )
 {
     unsigned int result   = 0x00000000L;
     unsigned int reserved = 0x00000000L;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc32_fletcher, ( unsigned int * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, reserved, hexin_crc32_fletcher_sums, reserved,
+                                  hexin_crc32_fletcher_sums_combine, hexin_crc32_fletcher_final, ( unsigned int * )&result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static PyObject * _crc32_adler32_combine( PyObject *self, PyObject *args )
+{
+    PyObject *padler1 = NULL, *padler2 = NULL, *plen2 = NULL;
+    unsigned long long adler1 = 0, adler2 = 0, len2 = 0;
+
+    if ( !PyArg_ParseTuple( args, "OOO:adler32_combine", &padler1, &padler2, &plen2 )
+      || !hexin_PyArg_Unsigned( padler1, &adler1 ) || !hexin_PyArg_Unsigned( padler2, &adler2 ) || !hexin_PyArg_Unsigned( plen2, &len2 ) ) {
+        return NULL;
+    }
+
+    if ( ( adler1 | adler2 ) > 0xFFFFFFFFULL ) {
+        PyErr_SetString( PyExc_ValueError, "adler must fit in 32 bits" );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( hexin_crc32_adler_combine( ( unsigned int )adler1, ( unsigned int )adler2, len2 ) );
+}
+
+static PyObject * _crc32_fletcher32_combine( PyObject *self, PyObject *args )
+{
+    PyObject *pfletcher1 = NULL, *pfletcher2 = NULL, *plen2 = NULL;
+    unsigned long long fletcher1 = 0, fletcher2 = 0, len2 = 0;
+
+    if ( !PyArg_ParseTuple( args, "OOO:fletcher32_combine", &pfletcher1, &pfletcher2, &plen2 )
+      || !hexin_PyArg_Unsigned( pfletcher1, &fletcher1 ) || !hexin_PyArg_Unsigned( pfletcher2, &fletcher2 ) || !hexin_PyArg_Unsigned( plen2, &len2 ) ) {
+        return NULL;
+    }
+
+    if ( ( fletcher1 | fletcher2 ) > 0xFFFFFFFFULL ) {
+        PyErr_SetString( PyExc_ValueError, "fletcher must fit in 32 bits" );
         return NULL;
     }
 
-    return Py_BuildValue( "I", result );
+    return PyLong_FromUnsignedLong( hexin_crc32_fletcher_combine( ( unsigned int )fletcher1, ( unsigned int )fletcher2, len2 ) );
 }
 
-static PyObject * _crc32_posix( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_param_posix = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0x00000000L,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFFFFFFL,
+                                                 .result = 0 };
+
+static PyObject * _crc32_posix( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_posix = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0x00000000L,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_posix ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_posix, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_posix.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 /*
 * Alias: CRC-32/AAL5, CRC-32/DECT-B, B-CRC-32
 */
-static PyObject * _crc32_bzip2( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_param_bzip2 = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0xFFFFFFFFL,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFFFFFFL,
+                                                 .result = 0 };
+
+static PyObject * _crc32_bzip2( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_bzip2 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_bzip2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_bzip2, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_bzip2.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_jamcrc( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_param_jamcrc = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC32_WIDTH,
+                                                  .poly   = 0x04C11DB7L,
+                                                  .init   = 0xFFFFFFFFL,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x00000000L,
+                                                  .result = 0 };
+
+static PyObject * _crc32_jamcrc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_jamcrc = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC32_WIDTH,
-                                                      .poly   = 0x04C11DB7L,
-                                                      .init   = 0xFFFFFFFFL,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x00000000L,
-                                                      .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_jamcrc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_jamcrc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_jamcrc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_autosar( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_param_autosar = { .is_initial=FALSE,
+                                                   .width  = HEXIN_CRC32_WIDTH,
+                                                   .poly   = 0xF4ACFB13L,
+                                                   .init   = 0xFFFFFFFFL,
+                                                   .refin  = TRUE,
+                                                   .refout = TRUE,
+                                                   .xorout = 0xFFFFFFFFL,
+                                                   .result = 0 };
+
+static PyObject * _crc32_autosar( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_autosar = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC32_WIDTH,
-                                                       .poly   = 0xF4ACFB13L,
-                                                       .init   = 0xFFFFFFFFL,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0xFFFFFFFFL,
-                                                       .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_autosar ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_autosar, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_autosar.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32_c( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_iscsi = { .is_initial=FALSE,
+                                           .width  = HEXIN_CRC32_WIDTH,
+                                           .poly   = 0x1EDC6F41L,
+                                           .init   = 0xFFFFFFFFL,
+                                           .refin  = TRUE,
+                                           .refout = TRUE,
+                                           .xorout = 0xFFFFFFFFL,
+                                           .result = 0 };
+
+static PyObject * _crc32_crc32_c( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_iscsi = { .is_initial=FALSE,
-                                               .width  = HEXIN_CRC32_WIDTH,
-                                               .poly   = 0x1EDC6F41L,
-                                               .init   = 0xFFFFFFFFL,
-                                               .refin  = TRUE,
-                                               .refout = TRUE,
-                                               .xorout = 0xFFFFFFFFL,
-                                               .result = 0 };
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_iscsi, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc32 crc32_base91 = { .is_initial=FALSE,
+                                            .width  = HEXIN_CRC32_WIDTH,
+                                            .poly   = 0xA833982BL,
+                                            .init   = 0xFFFFFFFFL,
+                                            .refin  = TRUE,
+                                            .refout = TRUE,
+                                            .xorout = 0xFFFFFFFFL,
+                                            .result = 0 };
+
+static PyObject * _crc32_crc32_d( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_iscsi ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_base91, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_iscsi.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32_d( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc32_aixm = { .is_initial=FALSE,
+                                          .width  = HEXIN_CRC32_WIDTH,
+                                          .poly   = 0x814141ABL,
+                                          .init   = 0,
+                                          .refin  = FALSE,
+                                          .refout = FALSE,
+                                          .xorout = 0,
+                                          .result = 0 };
+
+static PyObject * _crc32_crc32_q( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_base91 = { .is_initial=FALSE,
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_aixm, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc32 crc32_param_xfer = { .is_initial=FALSE,
                                                 .width  = HEXIN_CRC32_WIDTH,
-                                                .poly   = 0xA833982BL,
-                                                .init   = 0xFFFFFFFFL,
-                                                .refin  = TRUE,
-                                                .refout = TRUE,
-                                                .xorout = 0xFFFFFFFFL,
+                                                .poly   = 0x000000AFL,
+                                                .init   = 0x00000000L,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x00000000L,
                                                 .result = 0 };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_base91 ) ) {
+static PyObject * _crc32_xfer( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc32_param_xfer, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_base91.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32_q( PyObject *self, PyObject *args )
+static struct _hexin_crc32 crc30_cdma_param = { .is_initial=FALSE,
+                                                .width  = 30,
+                                                .poly   = CRC30_POLYNOMIAL_2030B9C7,
+                                                .init   = 0x3FFFFFFFL,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x3FFFFFFFL,
+                                                .result = 0 };
+
+static PyObject * _crc30_cdma( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc30_cdma_param, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc32 crc31_philips_param = { .is_initial=FALSE,
+                                                   .width  = 31,
+                                                   .poly   = CRC31_POLYNOMIAL_04C11DB7,
+                                                   .init   = 0x7FFFFFFFL,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x7FFFFFFFL,
+                                                   .result = 0 };
+
+static PyObject * _crc31_philips( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_aixm = { .is_initial=FALSE,
-                                              .width  = HEXIN_CRC32_WIDTH,
-                                              .poly   = 0x814141ABL,
-                                              .init   = 0,
-                                              .refin  = FALSE,
-                                              .refout = FALSE,
-                                              .xorout = 0,
-                                              .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_aixm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc31_philips_param, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_aixm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_xfer( PyObject *self, PyObject *args )
+static PyObject * _crc32_gil_threshold( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc32 crc32_param_xfer = { .is_initial=FALSE,
-                                                    .width  = HEXIN_CRC32_WIDTH,
-                                                    .poly   = 0x000000AFL,
-                                                    .init   = 0x00000000L,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x00000000L,
-                                                    .result = 0 };
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_xfer ) ) {
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_xfer.result );
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+static PyObject * _crc32_cache_info( PyObject *self, PyObject *args )
+{
+    unsigned long long hits = 0, misses = 0;
+    unsigned int count = 0;
+
+    hexin_crc32_cache_info( &hits, &misses, &count );
+    return Py_BuildValue( "KKII", hits, misses, ( unsigned int )HEXIN_CRC32_CACHE_SIZE, count );
+}
+
+static PyObject * _crc32_cache_clear( PyObject *self, PyObject *args )
+{
+    hexin_crc32_cache_clear();
+    Py_RETURN_NONE;
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_crc32_catalogue {
+    const char          *name;
+    struct _hexin_crc32  *param;
+} hexin_crc32_params[] = {
+    { "mpeg2",      &crc32_param_mpeg2 },
+    { "fsc",        &crc32_param_mpeg2 },
+    { "crc32",      &crc32_param_crc32 },
+    { "iso_hdlc32", &crc32_param_crc32 },
+    { "xz32",       &crc32_param_crc32 },
+    { "pkzip",      &crc32_param_crc32 },
+    { "adccp",      &crc32_param_crc32 },
+    { "v_42",       &crc32_param_crc32 },
+    { "posix",      &crc32_param_posix },
+    { "cksum",      &crc32_param_posix },
+    { "bzip2",      &crc32_param_bzip2 },
+    { "aal5",       &crc32_param_bzip2 },
+    { "jamcrc",     &crc32_param_jamcrc },
+    { "autosar",    &crc32_param_autosar },
+    { "crc32_c",    &crc32_iscsi },
+    { "iscsi",      &crc32_iscsi },
+    { "base91_c",   &crc32_iscsi },
+    { "crc32_d",    &crc32_base91 },
+    { "base91_d",   &crc32_base91 },
+    { "crc32_q",    &crc32_aixm },
+    { "aixm",       &crc32_aixm },
+    { "xfer",       &crc32_param_xfer },
+    { "cdma",       &crc30_cdma_param },
+    { "philips",    &crc31_philips_param },
+    { NULL, NULL }
+};
+
+static void hexin_crc32_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_crc32_params[i].name != NULL; i++ ) {
+        hexin_crc32_compute_init( hexin_crc32_params[i].param );
+    }
 }
 
-static PyObject * _crc30_cdma( PyObject *self, PyObject *args )
+static PyObject * _crc32_catalogue( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc32 crc30_cdma_param = { .is_initial=FALSE,
-                                                    .width  = 30,
-                                                    .poly   = CRC30_POLYNOMIAL_2030B9C7,
-                                                    .init   = 0x3FFFFFFFL,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x3FFFFFFFL,
-                                                    .result = 0 };
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_crc32 *param = NULL;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc30_cdma_param ) ) {
+    if ( pdict == NULL ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc30_cdma_param.result );
+    for ( i=0; hexin_crc32_params[i].name != NULL; i++ ) {
+        param = hexin_crc32_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_crc32_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
+}
+
+struct _hexin_crc32_records {
+    const struct _hexin_crc32  *param;
+    const unsigned char        *pSrc;
+    Py_ssize_t                  record_size;
+    Py_ssize_t                  offset;
+    Py_ssize_t                  length;
+    unsigned int             *values;
+};
+
+static void hexin_crc32_records_run( void *arg, Py_ssize_t begin, Py_ssize_t end )
+{
+    struct _hexin_crc32_records *records = ( struct _hexin_crc32_records * )arg;
+    const unsigned char *pSrc[HEXIN_CRC32_MULTI_CHUNK];
+    unsigned int len[HEXIN_CRC32_MULTI_CHUNK];
+    Py_ssize_t i = 0, n = 0;
+
+    for ( ; begin<end; begin+=n ) {
+        n = ( end - begin < HEXIN_CRC32_MULTI_CHUNK ) ? ( end - begin ) : HEXIN_CRC32_MULTI_CHUNK;
+        for ( i=0; i<n; i++ ) {
+            pSrc[i] = records->pSrc + ( begin + i ) * records->record_size + records->offset;
+            len[i]  = ( unsigned int )records->length;
+        }
+        hexin_crc32_compute_many( pSrc, len, ( unsigned int )n, records->param, records->values + begin );
+    }
+}
+
+/* Checks the records() layout against len bytes of data, FALSE with an exception set when it does not fit. */
+static unsigned int hexin_records_layout( Py_ssize_t len, Py_ssize_t record_size, Py_ssize_t offset, PyObject *plength,
+                                          PyObject *pcheck, Py_ssize_t field_size, const char *byteorder,
+                                          Py_ssize_t *length, Py_ssize_t *check, unsigned int *little )
+{
+    if ( ( record_size <= 0 ) || ( len % record_size != 0 ) ) {
+        PyErr_SetString( PyExc_ValueError, "data must be a whole number of record_size bytes" );
+        return FALSE;
+    }
+
+    *length = record_size - offset;
+    if ( plength != Py_None ) {
+        *length = PyNumber_AsSsize_t( plength, PyExc_OverflowError );
+        if ( ( *length == -1 ) && PyErr_Occurred() ) {
+            return FALSE;
+        }
+    }
+    if ( ( offset < 0 ) || ( *length < 0 ) || ( offset + *length > record_size ) || ( *length > 0xFFFFFFFFL ) ) {
+        PyErr_SetString( PyExc_ValueError, "offset and length must lie within the record" );
+        return FALSE;
+    }
+
+    *check = -1;
+    if ( pcheck != Py_None ) {
+        *check = PyNumber_AsSsize_t( pcheck, PyExc_OverflowError );
+        if ( ( *check == -1 ) && PyErr_Occurred() ) {
+            return FALSE;
+        }
+        if ( ( *check < 0 ) || ( *check + field_size > record_size ) ) {
+            PyErr_SetString( PyExc_ValueError, "the check field must lie within the record" );
+            return FALSE;
+        }
+    }
+
+    if ( ( strcmp( byteorder, "big" ) != 0 ) && ( strcmp( byteorder, "little" ) != 0 ) ) {
+        PyErr_SetString( PyExc_ValueError, "byteorder must be either 'little' or 'big'" );
+        return FALSE;
+    }
+    *little = ( strcmp( byteorder, "little" ) == 0 ) ? TRUE : FALSE;
+
+    return TRUE;
 }
 
-static PyObject * _crc31_philips( PyObject *self, PyObject *args )
+/*
+ * One CRC of record[offset:offset+length] per record_size bytes as array('I'). With check, the CRC
+ * stored at that offset of every record is compared instead and the indexes that differ come back.
+ */
+static PyObject * _crc32_records( PyObject *self, PyObject *args, PyObject *kws )
 {
-    static struct _hexin_crc32 crc31_philips_param = { .is_initial=FALSE,
-                                                       .width  = 31,
-                                                       .poly   = CRC31_POLYNOMIAL_04C11DB7,
-                                                       .init   = 0x7FFFFFFFL,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x7FFFFFFFL,
-                                                       .result = 0 };
+    Py_buffer data = { NULL, NULL };
+    const char *name = NULL, *byteorder = "big";
+    Py_ssize_t record_size = 0, offset = 0, check = -1, count = 0, i = 0, bad = 0;
+    PyObject *plength = Py_None, *pcheck = Py_None, *pthreads = NULL, *values = NULL, *array = NULL, *result = NULL;
+    unsigned int threads = 0, little = FALSE;
+    unsigned int stored = 0;
+    unsigned long long *indexes = NULL;
+    const unsigned char *pField = NULL;
+    struct _hexin_crc32_records records = { NULL };
+    const struct _hexin_model_capi *capi = NULL;
+
+    static char* kwlist[]={ "name", "data", "record_size", "offset", "length", "check", "byteorder", "threads", NULL };
+
+    if ( !hexin_PyArg_Positional( args, 7 ) ) {
+        return NULL;
+    }
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "sy*n|nOOsO", kwlist, &name, &data, &record_size, &offset,
+                                       &plength, &pcheck, &byteorder, &pthreads ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#else
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "ss*n|nOOsO", kwlist, &name, &data, &record_size, &offset,
+                                       &plength, &pcheck, &byteorder, &pthreads ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#endif /* PY_MAJOR_VERSION */
+
+    if ( !hexin_PyArg_Threads( pthreads, &threads ) ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc32_params[i].name != NULL; i++ ) {
+        if ( strcmp( hexin_crc32_params[i].name, name ) == 0 ) {
+            records.param = hexin_crc32_params[i].param;
+            break;
+        }
+    }
+    if ( records.param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unsupported CRC32 model '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( !hexin_records_layout( data.len, record_size, offset, plength, pcheck, sizeof( unsigned int ), byteorder,
+                                &records.length, &check, &little ) ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    count  = data.len / record_size;
+    values = PyBytes_FromStringAndSize( NULL, count * sizeof( unsigned int ) );
+    if ( values == NULL ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc31_philips_param ) ) {
+    records.pSrc        = ( const unsigned char * )data.buf;
+    records.record_size = record_size;
+    records.offset      = offset;
+    records.values      = ( unsigned int * )PyBytes_AS_STRING( values );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        capi = hexin_model_capi_import();
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi != NULL ) {
+            capi->parallel_for( hexin_crc32_records_run, &records, count, capi->threads( ( unsigned long long )data.len, threads ) );
+        } else {
+            hexin_crc32_records_run( &records, 0, count );
+        }
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_crc32_records_run( &records, 0, count );
+    }
+
+    if ( check >= 0 ) {
+        indexes = ( unsigned long long * )PyMem_Malloc( count * sizeof( unsigned long long ) + 1 );
+        if ( indexes == NULL ) {
+            Py_DECREF( values );
+            PyBuffer_Release( &data );
+            return PyErr_NoMemory();
+        }
+        for ( i=0; i<count; i++ ) {
+            pField = records.pSrc + i * record_size + check;
+            stored = little ? ( ( unsigned int )pField[0]       | ( ( unsigned int )pField[1] << 8  ) |
+                                ( ( unsigned int )pField[2] << 16 ) | ( ( unsigned int )pField[3] << 24 ) )
+                            : ( ( ( unsigned int )pField[0] << 24 ) | ( ( unsigned int )pField[1] << 16 ) |
+                                ( ( unsigned int )pField[2] << 8  ) |   ( unsigned int )pField[3] );
+            if ( stored != records.values[i] ) {
+                indexes[bad++] = ( unsigned long long )i;
+            }
+        }
+        Py_DECREF( values );
+        values = PyBytes_FromStringAndSize( ( const char * )indexes, bad * sizeof( unsigned long long ) );
+        PyMem_Free( indexes );
+    }
+    PyBuffer_Release( &data );
+
+    if ( values == NULL ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc31_philips_param.result );
+    array = PyImport_ImportModule( "array" );
+    if ( array != NULL ) {
+        result = PyObject_CallMethod( array, "array", "sO", ( check >= 0 ) ? "Q" : "I", values );
+        Py_DECREF( array );
+    }
+    Py_DECREF( values );
+
+    return result;
 }
 
 /* method table */
 static PyMethodDef _crc32Methods[] = {
-    { "mpeg2",       (PyCFunction)_crc32_mpeg_2,     METH_VARARGS,   "Calculate CRC (MPEG2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "fsc",         (PyCFunction)_crc32_mpeg_2,     METH_VARARGS,   "Calculate CRC (Ethernt's FSC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "crc32",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate CRC (WinRAR, File) of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "iso_hdlc32",  (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate ISO-HDLC of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "xz32",        (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate XZ of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "pkzip",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate PKZIP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "adccp",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate ADCCP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "v_42",        (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate V-42 of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "mpeg2",       (PyCFunction)_crc32_mpeg_2,     HEXIN_METH_FASTCALL,   "Calculate CRC (MPEG2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "fsc",         (PyCFunction)_crc32_mpeg_2,     HEXIN_METH_FASTCALL,   "Calculate CRC (Ethernt's FSC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "crc32",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate CRC (WinRAR, File) of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "iso_hdlc32",  (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate ISO-HDLC of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "xz32",        (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate XZ of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "pkzip",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate PKZIP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "adccp",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate ADCCP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "v_42",        (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate V-42 of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
     { "table32",     (PyCFunction)_crc32_table,      METH_VARARGS,   "Print CRC32 table to list. libscrc.table32( polynomial )" },
-    { "hacker32",    (PyCFunction)_crc32_hacker,     METH_KEYWORDS|METH_VARARGS, "User calculation CRC32\n"
+    { "hacker32",    (PyCFunction)_crc32_hacker,     HEXIN_METH_FASTCALL, "User calculation CRC32\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0xEDB88320\n"
                                                                                  "@init   : default=0xFFFFFFFF\n"
                                                                                  "@xorout : default=0x00000000\n"
                                                                                  "@ref    : default=False" },
-    { "adler32",    (PyCFunction)_crc32_adler32,     METH_VARARGS,   "Calculate adler32 (MOD=65521)" },
-    { "fletcher32", (PyCFunction)_crc32_fletcher32,  METH_VARARGS,   "Calculate fletcher32" },
-    { "posix",      (PyCFunction)_crc32_posix,       METH_VARARGS,   "Calculate CRC (POSIX) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "cksum",      (PyCFunction)_crc32_posix,       METH_VARARGS,   "Calculate CRC (CKSUM) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "bzip2",      (PyCFunction)_crc32_bzip2,       METH_VARARGS,   "Calculate CRC (BZIP2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "aal5",       (PyCFunction)_crc32_bzip2,       METH_VARARGS,   "Calculate CRC (AAL5) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "jamcrc",     (PyCFunction)_crc32_jamcrc,      METH_VARARGS,   "Calculate CRC (JAMCRC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "autosar",    (PyCFunction)_crc32_autosar,     METH_VARARGS,   "Calculate CRC (AUTOSAR) of CRC32 [Poly=0xF4ACFB13, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_c",    (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (CRC32-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "iscsi",      (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (ISCSI) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "base91_c",   (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (BASE91-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_d",    (PyCFunction)_crc32_crc32_d,     METH_VARARGS,   "Calculate CRC (CRC32-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "base91_d",   (PyCFunction)_crc32_crc32_d,     METH_VARARGS,   "Calculate CRC (BASE91-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_q",    (PyCFunction)_crc32_crc32_q,     METH_VARARGS,   "Calculate CRC (CRC32-Q) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "aixm",       (PyCFunction)_crc32_crc32_q,     METH_VARARGS,   "Calculate CRC (AIXM) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "xfer",       (PyCFunction)_crc32_xfer,        METH_VARARGS,   "Calculate CRC (XFER) of CRC32 [Poly=0x000000AF, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "cdma",       (PyCFunction)_crc30_cdma,        METH_VARARGS,   "Calculate CDMA of CRC30 [Poly=0x2030B9C7, Init=0x3FFFFFFF, Xorout=0x3FFFFFFF Refin=False Refout=False]"},
-    { "philips",    (PyCFunction)_crc31_philips,     METH_VARARGS,   "Calculate PHILIPS of CRC31 [Poly=0x04C11DB7, Init=0x7FFFFFFF, Xorout=0x7FFFFFFF Refin=False Refout=False]"},
+    { "adler32",    (PyCFunction)_crc32_adler32,     HEXIN_METH_FASTCALL,   "Calculate adler32 (MOD=65521) [Initial=0x00000001], adler32( data, previous, threads=1 ) streams like zlib.adler32" },
+    { "fletcher32", (PyCFunction)_crc32_fletcher32,  HEXIN_METH_FASTCALL,   "Calculate fletcher32" },
+    { "adler32_combine",    (PyCFunction)_crc32_adler32_combine,    METH_VARARGS, "adler32_combine(adler_a, adler_b, len_b) -> adler32 of a+b, same as zlib" },
+    { "fletcher32_combine", (PyCFunction)_crc32_fletcher32_combine, METH_VARARGS, "fletcher32_combine(fletcher_a, fletcher_b, len_b) -> fletcher32 of a+b, len( a ) even" },
+    { "posix",      (PyCFunction)_crc32_posix,       HEXIN_METH_FASTCALL,   "Calculate CRC (POSIX) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "cksum",      (PyCFunction)_crc32_posix,       HEXIN_METH_FASTCALL,   "Calculate CRC (CKSUM) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "bzip2",      (PyCFunction)_crc32_bzip2,       HEXIN_METH_FASTCALL,   "Calculate CRC (BZIP2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "aal5",       (PyCFunction)_crc32_bzip2,       HEXIN_METH_FASTCALL,   "Calculate CRC (AAL5) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "jamcrc",     (PyCFunction)_crc32_jamcrc,      HEXIN_METH_FASTCALL,   "Calculate CRC (JAMCRC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "autosar",    (PyCFunction)_crc32_autosar,     HEXIN_METH_FASTCALL,   "Calculate CRC (AUTOSAR) of CRC32 [Poly=0xF4ACFB13, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_c",    (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL,   "Calculate CRC (CRC32-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "iscsi",      (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL,   "Calculate CRC (ISCSI) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "base91_c",   (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL,   "Calculate CRC (BASE91-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_d",    (PyCFunction)_crc32_crc32_d,     HEXIN_METH_FASTCALL,   "Calculate CRC (CRC32-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "base91_d",   (PyCFunction)_crc32_crc32_d,     HEXIN_METH_FASTCALL,   "Calculate CRC (BASE91-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_q",    (PyCFunction)_crc32_crc32_q,     HEXIN_METH_FASTCALL,   "Calculate CRC (CRC32-Q) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "aixm",       (PyCFunction)_crc32_crc32_q,     HEXIN_METH_FASTCALL,   "Calculate CRC (AIXM) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "xfer",       (PyCFunction)_crc32_xfer,        HEXIN_METH_FASTCALL,   "Calculate CRC (XFER) of CRC32 [Poly=0x000000AF, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "cdma",       (PyCFunction)_crc30_cdma,        HEXIN_METH_FASTCALL,   "Calculate CDMA of CRC30 [Poly=0x2030B9C7, Init=0x3FFFFFFF, Xorout=0x3FFFFFFF Refin=False Refout=False]"},
+    { "philips",    (PyCFunction)_crc31_philips,     HEXIN_METH_FASTCALL,   "Calculate PHILIPS of CRC31 [Poly=0x04C11DB7, Init=0x7FFFFFFF, Xorout=0x7FFFFFFF Refin=False Refout=False]"},
+    { "_gil_threshold", (PyCFunction)_crc32_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_crc32_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
+    { "_records",       (PyCFunction)_crc32_records,       METH_KEYWORDS|METH_VARARGS, "CRC of every fixed-size record, see libscrc.records()" },
+    { "_cache_info",  (PyCFunction)_crc32_cache_info,  METH_NOARGS, "hacker32 table cache (hits, misses, maxsize, currsize)" },
+    { "_cache_clear", (PyCFunction)_crc32_cache_clear, METH_NOARGS, "Empty the hacker32 table cache and reset its counters" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -457,8 +943,10 @@ PyDoc_STRVAR( _crc32_doc,
 "libscrc.v_42       -> Calculate V-42 [Poly=0x04C11DB7L, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]\n"
 "libscrc.table32    -> Print CRC32 table to list\n"
 "libscrc.hacker32   -> Free calculation CRC32 (not support python2 series) Xorout=0x00000000 Refin=False Refout=False\n"
-"libscrc.adler32    -> Calculate adler32 (MOD=65521)\n"
+"libscrc.adler32    -> Calculate adler32 (MOD=65521), adler32( data, previous ) continues a stream\n"
 "libscrc.fletcher32 -> Calculate fletcher32\n"
+"libscrc.adler32_combine    -> adler32_combine(adler_a, adler_b, len_b), adler32 of a+b\n"
+"libscrc.fletcher32_combine -> fletcher32_combine(fletcher_a, fletcher_b, len_b), fletcher32 of a+b\n"
 "libscrc.posix      -> Calculate CRC (POSIX) [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=False Refout=False]\n"
 "libscrc.cksum      -> Calculate CRC (CKSUM) [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=False Refout=False]\n"
 "libscrc.bzip2      -> Calculate CRC (BZIP2) [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True  Refout=True]\n"
@@ -492,6 +980,11 @@ PyInit__crc32( void )
 {
     PyObject *m;
 
+    hexin_crc32_params_init();
+
+    /* Built here, the CRC32-C merge tables are read-only once the GIL can be released. */
+    hexin_crc32c_sse42_init();
+
     m = PyModule_Create( &_crc32module );
     if ( m == NULL ) {
         return NULL;
@@ -509,6 +1002,8 @@ PyInit__crc32( void )
 PyMODINIT_FUNC
 init_crc32( void )
 {
+    hexin_crc32_params_init();
+    hexin_crc32c_sse42_init();
     ( void ) Py_InitModule3( "_crc32", _crc32Methods, _crc32_doc );
 }
 
@@ -0,0 +1,620 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _crc32simd.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. PCLMULQDQ folding for any 32-bit polynomial.
+*                       2026-10-17 [Heyn] New add SSE4.2 CRC32-C with three interleaved streams.
+*                       2026-10-17 [Heyn] New add the AVX2 multi-buffer kernel, 16 messages side by side.
+*                       2026-10-17 [Heyn] New add the SSSE3 / AVX2 Adler-32 sums.
+*                       2026-10-17 [Heyn] New add the AVX2 Fletcher-32 sums.
+*                       2026-10-17 [Heyn] CPUID / XGETBV and the target attributes moved to _modelcpuid.h, only the kernels are left here.
+*
+*   SEE : Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+*         Mark Adler, crc32c.c ( https://stackoverflow.com/a/17646775 )
+*
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "_crc32simd.h"
+
+/*
+ * The three CRC32-C streams are merged by running the first register over the length
+ * of a stream of zeros, which is a linear map applied here with four 256-entry tables.
+ */
+#define                 HEXIN_CRC32C_LONG                       8192
+#define                 HEXIN_CRC32C_SHORT                      256
+
+static unsigned int hexin_crc32c_long[4][MAX_TABLE_ARRAY];
+static unsigned int hexin_crc32c_short[4][MAX_TABLE_ARRAY];
+
+static unsigned int hexin_gf2_matrix_times( const unsigned int *mat, unsigned int vec )
+{
+    unsigned int sum = 0;
+
+    while ( vec ) {
+        if ( vec & 1 ) {
+            sum ^= *mat;
+        }
+        vec >>= 1;
+        mat++;
+    }
+    return sum;
+}
+
+static void hexin_gf2_matrix_square( unsigned int *square, const unsigned int *mat )
+{
+    unsigned int n = 0;
+
+    for ( n=0; n<32; n++ ) {
+        square[n] = hexin_gf2_matrix_times( mat, mat[n] );
+    }
+}
+
+/* Operator for len zero bytes ( len is a power of two ). */
+static void hexin_crc32c_zeros_op( unsigned int *even, unsigned int len )
+{
+    unsigned int n = 0, row = 1;
+    unsigned int odd[32];
+
+    odd[0] = HEXIN_CRC32C_POLYNOMIAL_REV;           /* one zero bit */
+    for ( n=1; n<32; n++ ) {
+        odd[n] = row;
+        row <<= 1;
+    }
+
+    hexin_gf2_matrix_square( even, odd );           /* two zero bits  */
+    hexin_gf2_matrix_square( odd, even );           /* four zero bits */
+
+    do {
+        hexin_gf2_matrix_square( even, odd );
+        len >>= 1;
+        if ( len == 0 ) {
+            return;
+        }
+        hexin_gf2_matrix_square( odd, even );
+        len >>= 1;
+    } while ( len );
+
+    for ( n=0; n<32; n++ ) {
+        even[n] = odd[n];
+    }
+}
+
+static void hexin_crc32c_zeros( unsigned int zeros[][MAX_TABLE_ARRAY], unsigned int len )
+{
+    unsigned int n = 0;
+    unsigned int op[32];
+
+    hexin_crc32c_zeros_op( op, len );
+    for ( n=0; n<MAX_TABLE_ARRAY; n++ ) {
+        zeros[0][n] = hexin_gf2_matrix_times( op, n       );
+        zeros[1][n] = hexin_gf2_matrix_times( op, n << 8  );
+        zeros[2][n] = hexin_gf2_matrix_times( op, n << 16 );
+        zeros[3][n] = hexin_gf2_matrix_times( op, n << 24 );
+    }
+}
+
+static unsigned int hexin_crc32c_shift( unsigned int zeros[][MAX_TABLE_ARRAY], unsigned int crc )
+{
+    return zeros[0][ crc & 0xFF ] ^ zeros[1][ ( crc >> 8 ) & 0xFF ] ^ zeros[2][ ( crc >> 16 ) & 0xFF ] ^ zeros[3][ crc >> 24 ];
+}
+
+unsigned int hexin_crc32c_sse42_init( void )
+{
+    static unsigned int is_initial = FALSE;
+
+    if ( is_initial == FALSE ) {
+        hexin_crc32c_zeros( hexin_crc32c_long,  HEXIN_CRC32C_LONG  );
+        hexin_crc32c_zeros( hexin_crc32c_short, HEXIN_CRC32C_SHORT );
+        is_initial = TRUE;
+    }
+    return is_initial;
+}
+
+#if defined( HEXIN_X86_SIMD )
+
+#include <immintrin.h>
+
+unsigned int hexin_crc32_simd_clmul_support( void )
+{
+    static int support = -1;
+    unsigned int mask  = HEXIN_CPUID_ECX_SSSE3 | HEXIN_CPUID_ECX_PCLMULQDQ;
+
+    if ( support < 0 ) {
+        support = ( ( hexin_cpuid_ecx() & mask ) == mask ) ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+unsigned int hexin_crc32_simd_sse42_support( void )
+{
+    static int support = -1;
+
+    if ( support < 0 ) {
+        support = ( hexin_cpuid_ecx() & HEXIN_CPUID_ECX_SSE42 ) ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+unsigned int hexin_crc32_simd_ssse3_support( void )
+{
+    static int support = -1;
+
+    if ( support < 0 ) {
+        support = ( hexin_cpuid_ecx() & HEXIN_CPUID_ECX_SSSE3 ) ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+unsigned int hexin_crc32_simd_avx2_support( void )
+{
+    static int support = -1;
+
+    if ( support < 0 ) {
+        support = hexin_cpuid_avx2() ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+static HEXIN_TARGET_SSE42 unsigned int hexin_crc32c_sse42_word( unsigned int crc, const unsigned char *pSrc )
+{
+    unsigned long long word = 0;
+    memcpy( &word, pSrc, sizeof( word ) );
+    return ( unsigned int )_mm_crc32_u64( crc, word );
+}
+#else
+static HEXIN_TARGET_SSE42 unsigned int hexin_crc32c_sse42_word( unsigned int crc, const unsigned char *pSrc )
+{
+    unsigned int word[2] = { 0 };
+    memcpy( word, pSrc, sizeof( word ) );
+    return _mm_crc32_u32( _mm_crc32_u32( crc, word[0] ), word[1] );
+}
+#endif
+
+/*
+ * The crc32 instruction has a latency of three cycles but a throughput of one, so
+ * large buffers are cut into three adjacent streams that are computed side by side
+ * and merged with hexin_crc32c_shift().
+ */
+HEXIN_TARGET_SSE42
+unsigned int hexin_crc32c_sse42( unsigned int crc32, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned int crc0 = crc32, crc1 = 0, crc2 = 0;
+    const unsigned char *end = NULL;
+
+    while ( len && ( ( ( size_t )pSrc ) & 7 ) ) {
+        crc0 = _mm_crc32_u8( crc0, *pSrc++ );
+        len--;
+    }
+
+    while ( len >= HEXIN_CRC32C_LONG*3 ) {
+        crc1 = 0;
+        crc2 = 0;
+        end  = pSrc + HEXIN_CRC32C_LONG;
+        do {
+            crc0 = hexin_crc32c_sse42_word( crc0, pSrc );
+            crc1 = hexin_crc32c_sse42_word( crc1, pSrc + HEXIN_CRC32C_LONG   );
+            crc2 = hexin_crc32c_sse42_word( crc2, pSrc + HEXIN_CRC32C_LONG*2 );
+            pSrc += 8;
+        } while ( pSrc < end );
+        crc0  = hexin_crc32c_shift( hexin_crc32c_long, crc0 ) ^ crc1;
+        crc0  = hexin_crc32c_shift( hexin_crc32c_long, crc0 ) ^ crc2;
+        pSrc += HEXIN_CRC32C_LONG*2;
+        len  -= HEXIN_CRC32C_LONG*3;
+    }
+
+    while ( len >= HEXIN_CRC32C_SHORT*3 ) {
+        crc1 = 0;
+        crc2 = 0;
+        end  = pSrc + HEXIN_CRC32C_SHORT;
+        do {
+            crc0 = hexin_crc32c_sse42_word( crc0, pSrc );
+            crc1 = hexin_crc32c_sse42_word( crc1, pSrc + HEXIN_CRC32C_SHORT   );
+            crc2 = hexin_crc32c_sse42_word( crc2, pSrc + HEXIN_CRC32C_SHORT*2 );
+            pSrc += 8;
+        } while ( pSrc < end );
+        crc0  = hexin_crc32c_shift( hexin_crc32c_short, crc0 ) ^ crc1;
+        crc0  = hexin_crc32c_shift( hexin_crc32c_short, crc0 ) ^ crc2;
+        pSrc += HEXIN_CRC32C_SHORT*2;
+        len  -= HEXIN_CRC32C_SHORT*3;
+    }
+
+    while ( len >= 8 ) {
+        crc0  = hexin_crc32c_sse42_word( crc0, pSrc );
+        pSrc += 8;
+        len  -= 8;
+    }
+
+    while ( len-- ) {
+        crc0 = _mm_crc32_u8( crc0, *pSrc++ );
+    }
+
+    return crc0;
+}
+
+/*
+ * Multiply both 64-bit halves of x by the matching lane of k and add them up.
+ * The lanes of k are laid out by hexin_crc32_compute_init_fold() so that the same
+ * code folds reflected and MSB-first data.
+ */
+static HEXIN_TARGET_CLMUL __m128i hexin_crc32_fold128( __m128i x, __m128i k )
+{
+    return _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ), _mm_clmulepi64_si128( x, k, 0x11 ) );
+}
+
+HEXIN_TARGET_CLMUL
+unsigned int hexin_crc32_fold_clmul( unsigned int crc32, const unsigned char *pSrc, unsigned int len,
+                                     const struct _hexin_crc32 *param )
+{
+    unsigned int i = 0, crc = 0;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param );
+    unsigned char remainder[16];
+    const __m128i bswap = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+    const __m128i k512  = _mm_set_epi64x( ( long long )param->fold[1], ( long long )param->fold[0] );
+    const __m128i k384  = _mm_set_epi64x( ( long long )param->fold[3], ( long long )param->fold[2] );
+    const __m128i k256  = _mm_set_epi64x( ( long long )param->fold[5], ( long long )param->fold[4] );
+    const __m128i k128  = _mm_set_epi64x( ( long long )param->fold[7], ( long long )param->fold[6] );
+    __m128i x0, x1, x2, x3, b0, b1, b2, b3;
+
+    /* The register is the CRC of nothing, so it just gets xored onto the first four bytes. */
+    if ( reflected ) {
+        x0 = _mm_xor_si128( _mm_loadu_si128( ( const __m128i * )pSrc ), _mm_cvtsi32_si128( ( int )crc32 ) );
+    } else {
+        x0 = _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i * )pSrc ), bswap );
+        x0 = _mm_xor_si128( x0, _mm_slli_si128( _mm_cvtsi32_si128( ( int )crc32 ), 12 ) );
+    }
+    pSrc += 16;
+    len  -= 16;
+
+    if ( len >= 112 ) {
+        x1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+        x2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+        x3 = _mm_loadu_si128( ( const __m128i * )( pSrc + 32 ) );
+        if ( !reflected ) {
+            x1 = _mm_shuffle_epi8( x1, bswap );
+            x2 = _mm_shuffle_epi8( x2, bswap );
+            x3 = _mm_shuffle_epi8( x3, bswap );
+        }
+        pSrc += 48;
+        len  -= 48;
+
+        while ( len >= 64 ) {
+            b0 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+            b1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+            b2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 32 ) );
+            b3 = _mm_loadu_si128( ( const __m128i * )( pSrc + 48 ) );
+            if ( !reflected ) {
+                b0 = _mm_shuffle_epi8( b0, bswap );
+                b1 = _mm_shuffle_epi8( b1, bswap );
+                b2 = _mm_shuffle_epi8( b2, bswap );
+                b3 = _mm_shuffle_epi8( b3, bswap );
+            }
+            x0 = _mm_xor_si128( hexin_crc32_fold128( x0, k512 ), b0 );
+            x1 = _mm_xor_si128( hexin_crc32_fold128( x1, k512 ), b1 );
+            x2 = _mm_xor_si128( hexin_crc32_fold128( x2, k512 ), b2 );
+            x3 = _mm_xor_si128( hexin_crc32_fold128( x3, k512 ), b3 );
+            pSrc += 64;
+            len  -= 64;
+        }
+
+        x0 = _mm_xor_si128( hexin_crc32_fold128( x0, k384 ), hexin_crc32_fold128( x1, k256 ) );
+        x0 = _mm_xor_si128( x0, hexin_crc32_fold128( x2, k128 ) );
+        x0 = _mm_xor_si128( x0, x3 );
+    }
+
+    while ( len >= 16 ) {
+        b0 = _mm_loadu_si128( ( const __m128i * )pSrc );
+        if ( !reflected ) {
+            b0 = _mm_shuffle_epi8( b0, bswap );
+        }
+        x0 = _mm_xor_si128( hexin_crc32_fold128( x0, k128 ), b0 );
+        pSrc += 16;
+        len  -= 16;
+    }
+
+    /* x0 is congruent to everything folded so far, its CRC is the register. */
+    if ( !reflected ) {
+        x0 = _mm_shuffle_epi8( x0, bswap );
+    }
+    _mm_storeu_si128( ( __m128i * )remainder, x0 );
+
+    if ( reflected ) {
+        for ( i=0; i<16; i++ ) {
+            crc = ( crc >> 8 ) ^ param->table[0][ ( crc ^ remainder[i] ) & 0xFF ];
+        }
+        while ( len-- ) {
+            crc = ( crc >> 8 ) ^ param->table[0][ ( crc ^ *pSrc++ ) & 0xFF ];
+        }
+    } else {
+        for ( i=0; i<16; i++ ) {
+            crc = ( crc << 8 ) ^ param->table[0][ ( ( crc >> 24 ) ^ remainder[i] ) & 0xFF ];
+        }
+        while ( len-- ) {
+            crc = ( crc << 8 ) ^ param->table[0][ ( ( crc >> 24 ) ^ *pSrc++ ) & 0xFF ];
+        }
+    }
+
+    return crc;
+}
+
+/* Next four bytes of eight lanes, one 32-bit word per lane in memory order. */
+static HEXIN_TARGET_AVX2 unsigned int hexin_crc32_lane_word( const unsigned char *pSrc )
+{
+    unsigned int word = 0;
+
+    memcpy( &word, pSrc, sizeof( word ) );
+    return word;
+}
+
+static HEXIN_TARGET_AVX2 __m256i hexin_crc32_lanes_load( const unsigned char **pSrc, unsigned int offset )
+{
+    return _mm256_set_epi32( ( int )hexin_crc32_lane_word( pSrc[7] + offset ), ( int )hexin_crc32_lane_word( pSrc[6] + offset ),
+                             ( int )hexin_crc32_lane_word( pSrc[5] + offset ), ( int )hexin_crc32_lane_word( pSrc[4] + offset ),
+                             ( int )hexin_crc32_lane_word( pSrc[3] + offset ), ( int )hexin_crc32_lane_word( pSrc[2] + offset ),
+                             ( int )hexin_crc32_lane_word( pSrc[1] + offset ), ( int )hexin_crc32_lane_word( pSrc[0] + offset ) );
+}
+
+/* Slicing-by-4 on eight lanes, x is the register xored with the next word ( top byte first if MSB-first ). */
+static HEXIN_TARGET_AVX2 __m256i hexin_crc32_lanes_slice( __m256i x, const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected )
+{
+    const __m256i mask = _mm256_set1_epi32( 0xFF );
+    __m256i b0 = _mm256_and_si256( x, mask );
+    __m256i b1 = _mm256_and_si256( _mm256_srli_epi32( x, 8  ), mask );
+    __m256i b2 = _mm256_and_si256( _mm256_srli_epi32( x, 16 ), mask );
+    __m256i b3 = _mm256_srli_epi32( x, 24 );
+
+    if ( reflected ) {
+        x = _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[3], b0, 4 ), _mm256_i32gather_epi32( ( const int * )table[2], b1, 4 ) );
+        return _mm256_xor_si256( x, _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[1], b2, 4 ),
+                                                      _mm256_i32gather_epi32( ( const int * )table[0], b3, 4 ) ) );
+    }
+    x = _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[3], b3, 4 ), _mm256_i32gather_epi32( ( const int * )table[2], b2, 4 ) );
+    return _mm256_xor_si256( x, _mm256_xor_si256( _mm256_i32gather_epi32( ( const int * )table[1], b1, 4 ),
+                                                  _mm256_i32gather_epi32( ( const int * )table[0], b0, 4 ) ) );
+}
+
+/*
+ * len bytes of HEXIN_CRC32_LANES independent messages, two groups of eight lanes interleaved to
+ * hide the gather latency. crc holds the raw registers, pSrc moves past the bytes taken, len is a
+ * multiple of 4. table[j] is the CRC of a byte followed by j zero bytes, as in param->table.
+ */
+HEXIN_TARGET_AVX2
+void hexin_crc32_multi_avx2( unsigned int *crc, const unsigned char **pSrc, unsigned int len,
+                             const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected )
+{
+    const __m256i bswap = _mm256_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                           12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+    __m256i x0 = _mm256_loadu_si256( ( const __m256i * )( crc + 0 ) );
+    __m256i x1 = _mm256_loadu_si256( ( const __m256i * )( crc + 8 ) );
+    __m256i w0, w1;
+    unsigned int i = 0, l = 0;
+
+    for ( i=0; i<len; i+=4 ) {
+        w0 = hexin_crc32_lanes_load( pSrc + 0, i );
+        w1 = hexin_crc32_lanes_load( pSrc + 8, i );
+        if ( reflected ) {
+            x0 = _mm256_xor_si256( x0, w0 );
+            x1 = _mm256_xor_si256( x1, w1 );
+        } else {
+            x0 = _mm256_xor_si256( x0, _mm256_shuffle_epi8( w0, bswap ) );
+            x1 = _mm256_xor_si256( x1, _mm256_shuffle_epi8( w1, bswap ) );
+        }
+        x0 = hexin_crc32_lanes_slice( x0, table, reflected );
+        x1 = hexin_crc32_lanes_slice( x1, table, reflected );
+    }
+
+    _mm256_storeu_si256( ( __m256i * )( crc + 0 ), x0 );
+    _mm256_storeu_si256( ( __m256i * )( crc + 8 ), x1 );
+    for ( l=0; l<HEXIN_CRC32_LANES; l++ ) {
+        pSrc[l] += len;
+    }
+}
+
+
+/*
+ * Adler-32 over whole blocks of HEXIN_ADLER_SSSE3_BLOCK bytes. Within a block sum1 grows by the
+ * byte sum ( psadbw ) and sum2 by the bytes weighted 32..1 ( pmaddubsw ), plus 32 times sum1 as
+ * it was before the block ( ps ). Nothing is reduced before HEXIN_ADLER_NMAX bytes.
+ */
+HEXIN_TARGET_SSSE3
+unsigned int hexin_adler32_ssse3( unsigned int adler, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned int sum1 = ( adler & 0xFFFF ) % HEXIN_MOD_ADLER, sum2 = ( adler >> 16 ) % HEXIN_MOD_ADLER;
+    unsigned int blocks = len / HEXIN_ADLER_SSSE3_BLOCK, n = 0;
+    const __m128i tap1 = _mm_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+    const __m128i tap2 = _mm_setr_epi8( 16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16( 1 );
+    __m128i ps, s1, s2, b0, b1;
+
+    while ( blocks > 0 ) {
+        n = ( blocks < HEXIN_ADLER_NMAX / HEXIN_ADLER_SSSE3_BLOCK ) ? blocks : HEXIN_ADLER_NMAX / HEXIN_ADLER_SSSE3_BLOCK;
+        blocks -= n;
+
+        ps = _mm_cvtsi32_si128( ( int )( sum1 * n ) );
+        s2 = _mm_cvtsi32_si128( ( int )sum2 );
+        s1 = _mm_setzero_si128();
+        do {
+            b0 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+            b1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+            ps = _mm_add_epi32( ps, s1 );
+            s1 = _mm_add_epi32( s1, _mm_sad_epu8( b0, zero ) );
+            s1 = _mm_add_epi32( s1, _mm_sad_epu8( b1, zero ) );
+            s2 = _mm_add_epi32( s2, _mm_madd_epi16( _mm_maddubs_epi16( b0, tap1 ), ones ) );
+            s2 = _mm_add_epi32( s2, _mm_madd_epi16( _mm_maddubs_epi16( b1, tap2 ), ones ) );
+            pSrc += HEXIN_ADLER_SSSE3_BLOCK;
+        } while ( --n );
+        s2 = _mm_add_epi32( s2, _mm_slli_epi32( ps, 5 ) );
+
+        s1 = _mm_add_epi32( s1, _mm_shuffle_epi32( s1, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        s1 = _mm_add_epi32( s1, _mm_shuffle_epi32( s1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        s2 = _mm_add_epi32( s2, _mm_shuffle_epi32( s2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        s2 = _mm_add_epi32( s2, _mm_shuffle_epi32( s2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        sum1 = ( sum1 + ( unsigned int )_mm_cvtsi128_si32( s1 ) ) % HEXIN_MOD_ADLER;
+        sum2 = ( unsigned int )_mm_cvtsi128_si32( s2 ) % HEXIN_MOD_ADLER;
+    }
+    return ( sum2 << 16 ) | sum1;
+}
+
+/* Same as hexin_adler32_ssse3() with two 32-byte registers per block, weights 64..33 and 32..1. */
+HEXIN_TARGET_AVX2
+unsigned int hexin_adler32_avx2( unsigned int adler, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned int sum1 = ( adler & 0xFFFF ) % HEXIN_MOD_ADLER, sum2 = ( adler >> 16 ) % HEXIN_MOD_ADLER;
+    unsigned int blocks = len / HEXIN_ADLER_AVX2_BLOCK, n = 0;
+    const __m256i tap1 = _mm256_setr_epi8( 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49,
+                                           48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33 );
+    const __m256i tap2 = _mm256_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                           16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16( 1 );
+    __m256i ps, s1, s2, b0, b1;
+    __m128i h1, h2;
+
+    while ( blocks > 0 ) {
+        n = ( blocks < HEXIN_ADLER_NMAX / HEXIN_ADLER_AVX2_BLOCK ) ? blocks : HEXIN_ADLER_NMAX / HEXIN_ADLER_AVX2_BLOCK;
+        blocks -= n;
+
+        ps = _mm256_setr_epi32( ( int )( sum1 * n ), 0, 0, 0, 0, 0, 0, 0 );
+        s2 = _mm256_setr_epi32( ( int )sum2, 0, 0, 0, 0, 0, 0, 0 );
+        s1 = _mm256_setzero_si256();
+        do {
+            b0 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 0  ) );
+            b1 = _mm256_loadu_si256( ( const __m256i * )( pSrc + 32 ) );
+            ps = _mm256_add_epi32( ps, s1 );
+            s1 = _mm256_add_epi32( s1, _mm256_add_epi64( _mm256_sad_epu8( b0, zero ), _mm256_sad_epu8( b1, zero ) ) );
+            s2 = _mm256_add_epi32( s2, _mm256_madd_epi16( _mm256_maddubs_epi16( b0, tap1 ), ones ) );
+            s2 = _mm256_add_epi32( s2, _mm256_madd_epi16( _mm256_maddubs_epi16( b1, tap2 ), ones ) );
+            pSrc += HEXIN_ADLER_AVX2_BLOCK;
+        } while ( --n );
+        s2 = _mm256_add_epi32( s2, _mm256_slli_epi32( ps, 6 ) );
+
+        h1 = _mm_add_epi32( _mm256_castsi256_si128( s1 ), _mm256_extracti128_si256( s1, 1 ) );
+        h2 = _mm_add_epi32( _mm256_castsi256_si128( s2 ), _mm256_extracti128_si256( s2, 1 ) );
+        h1 = _mm_add_epi32( h1, _mm_shuffle_epi32( h1, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        h1 = _mm_add_epi32( h1, _mm_shuffle_epi32( h1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        h2 = _mm_add_epi32( h2, _mm_shuffle_epi32( h2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        h2 = _mm_add_epi32( h2, _mm_shuffle_epi32( h2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        sum1 = ( sum1 + ( unsigned int )_mm_cvtsi128_si32( h1 ) ) % HEXIN_MOD_ADLER;
+        sum2 = ( unsigned int )_mm_cvtsi128_si32( h2 ) % HEXIN_MOD_ADLER;
+    }
+    return ( sum2 << 16 ) | sum1;
+}
+
+/* Sum of the eight signed lanes, the prefix sums outgrow 32 bits once added up. */
+static HEXIN_TARGET_AVX2 long long hexin_fletcher32_hsum( __m256i x )
+{
+    __m256i q = _mm256_add_epi64( _mm256_cvtepi32_epi64( _mm256_castsi256_si128( x ) ),
+                                  _mm256_cvtepi32_epi64( _mm256_extracti128_si256( x, 1 ) ) );
+    __m128i h = _mm_add_epi64( _mm256_castsi256_si128( q ), _mm256_extracti128_si256( q, 1 ) );
+
+    return ( long long )_mm_cvtsi128_si64( _mm_add_epi64( h, _mm_unpackhi_epi64( h, h ) ) );
+}
+
+/*
+ * Fletcher-32 sums over whole 64-byte blocks ( 32 words ), fletcher holds sum1 | sum2 << 16 and the
+ * result is reduced to 0 .. 65534. The words are flipped by 0x8000 to suit the signed madd, that is
+ * 32768 less per word, added back when the lanes are reduced every HEXIN_FLETCHER_AVX2_NMAX blocks.
+ * sum2 gains ( 32 - k ) times word k of a block, plus 32 times the sum1 of the blocks before ( ps ).
+ */
+HEXIN_TARGET_AVX2
+unsigned int hexin_fletcher32_avx2( unsigned int fletcher, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned long long sum1 = fletcher & 0xFFFF, sum2 = fletcher >> 16;
+    unsigned long long n = 0, words = 0;
+    unsigned int blocks = len / HEXIN_FLETCHER_AVX2_BLOCK, i = 0;
+    const __m256i flip = _mm256_set1_epi16( ( short )0x8000 );
+    const __m256i tap1 = _mm256_setr_epi16( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+    const __m256i tap2 = _mm256_setr_epi16( 16, 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1 );
+    const __m256i ones = _mm256_set1_epi16( 1 );
+    __m256i ps, s1, s2, b0, b1;
+
+    while ( blocks > 0 ) {
+        n = ( blocks < HEXIN_FLETCHER_AVX2_NMAX ) ? blocks : HEXIN_FLETCHER_AVX2_NMAX;
+        blocks -= ( unsigned int )n;
+
+        ps = _mm256_setzero_si256();
+        s1 = _mm256_setzero_si256();
+        s2 = _mm256_setzero_si256();
+        for ( i=0; i<n; i++ ) {
+            b0 = _mm256_xor_si256( _mm256_loadu_si256( ( const __m256i * )( pSrc + 0  ) ), flip );
+            b1 = _mm256_xor_si256( _mm256_loadu_si256( ( const __m256i * )( pSrc + 32 ) ), flip );
+            ps = _mm256_add_epi32( ps, s1 );
+            s1 = _mm256_add_epi32( s1, _mm256_add_epi32( _mm256_madd_epi16( b0, ones ), _mm256_madd_epi16( b1, ones ) ) );
+            s2 = _mm256_add_epi32( s2, _mm256_add_epi32( _mm256_madd_epi16( b0, tap1 ), _mm256_madd_epi16( b1, tap2 ) ) );
+            pSrc += HEXIN_FLETCHER_AVX2_BLOCK;
+        }
+
+        /* 32 words a block, 1 + 2 + .. + 32 = 528, n * ( n - 1 ) / 2 blocks behind one another in ps. */
+        words = n * 32;
+        sum2 += words * sum1 + ( unsigned long long )( 32 * hexin_fletcher32_hsum( ps ) + hexin_fletcher32_hsum( s2 )
+                                                        + ( long long )( 32 * 32 * 32768 * ( n * ( n - 1 ) / 2 ) + 528 * 32768 * n ) );
+        sum1 += ( unsigned long long )( hexin_fletcher32_hsum( s1 ) + ( long long )( words * 32768 ) );
+        sum1 %= HEXIN_MOD_FLETCHER;
+        sum2 %= HEXIN_MOD_FLETCHER;
+    }
+    return ( unsigned int )( sum1 | ( sum2 << 16 ) );
+}
+
+#else
+
+unsigned int hexin_crc32_simd_sse42_support( void )
+{
+    return FALSE;
+}
+
+unsigned int hexin_crc32c_sse42( unsigned int crc32, const unsigned char *pSrc, unsigned int len )
+{
+    return crc32;
+}
+
+unsigned int hexin_crc32_simd_clmul_support( void )
+{
+    return FALSE;
+}
+
+unsigned int hexin_crc32_simd_ssse3_support( void )
+{
+    return FALSE;
+}
+
+unsigned int hexin_crc32_simd_avx2_support( void )
+{
+    return FALSE;
+}
+
+unsigned int hexin_adler32_ssse3( unsigned int adler, const unsigned char *pSrc, unsigned int len )
+{
+    return adler;
+}
+
+unsigned int hexin_adler32_avx2( unsigned int adler, const unsigned char *pSrc, unsigned int len )
+{
+    return adler;
+}
+
+unsigned int hexin_fletcher32_avx2( unsigned int fletcher, const unsigned char *pSrc, unsigned int len )
+{
+    return fletcher;
+}
+
+unsigned int hexin_crc32_fold_clmul( unsigned int crc32, const unsigned char *pSrc, unsigned int len,
+                                     const struct _hexin_crc32 *param )
+{
+    return crc32;
+}
+
+void hexin_crc32_multi_avx2( unsigned int *crc, const unsigned char **pSrc, unsigned int len,
+                             const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected )
+{
+}
+
+#endif /* HEXIN_X86_SIMD */
@@ -0,0 +1,72 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _crc32simd.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize.
+*                       2026-10-17 [Heyn] New add SSE4.2 CRC32-C path.
+*                       2026-10-17 [Heyn] New add the AVX2 multi-buffer kernel.
+*                       2026-10-17 [Heyn] New add the SSSE3 / AVX2 Adler-32 sums.
+*                       2026-10-17 [Heyn] New add the AVX2 Fletcher-32 sums.
+*                       2026-10-17 [Heyn] HEXIN_X86_SIMD and the CPUID helpers come from _modelcpuid.h.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __CRC32_SIMD_H__
+#define __CRC32_SIMD_H__
+
+#include "_crc32tables.h"
+
+#include "_modelcpuid.h"
+
+/* Castagnoli polynomial, the reflected form is native to the SSE4.2 crc32 instruction. */
+#define                 HEXIN_CRC32C_POLYNOMIAL                 0x1EDC6F41L
+#define                 HEXIN_CRC32C_POLYNOMIAL_REV             0x82F63B78L
+#define                 HEXIN_CRC32_IS_CASTAGNOLI(x)            ( HEXIN_REFIN_REFOUT_IS_TRUE( x ) && ( x->width == HEXIN_CRC32_WIDTH ) \
+                                                                  && ( x->poly == HEXIN_CRC32C_POLYNOMIAL ) )
+
+/* Below this size the slicing-by-8 loop is faster than setting up the folds. */
+#define                 HEXIN_CRC32_FOLD_MINSIZE                64
+
+/* Messages computed side by side by hexin_crc32_multi_avx2(). */
+#define                 HEXIN_CRC32_LANES                       16
+
+/* From this size a message is faster on its own through the folds than in a lane. */
+#define                 HEXIN_CRC32_MULTI_MAXSIZE               128
+
+/* Messages sorted by length at a time, lanes are filled from neighbours in that order. */
+#define                 HEXIN_CRC32_MULTI_CHUNK                 1024
+
+unsigned int hexin_crc32_simd_clmul_support( void );
+unsigned int hexin_crc32_simd_ssse3_support( void );
+unsigned int hexin_crc32_simd_avx2_support( void );
+
+/* Bytes per loop of the Adler-32 vector sums, buffers under the larger one stay scalar. */
+#define                 HEXIN_ADLER_SSSE3_BLOCK                 32
+#define                 HEXIN_ADLER_AVX2_BLOCK                  64
+
+/* Bytes per loop of the Fletcher-32 vector sums, and loops between two reductions of the lanes. */
+#define                 HEXIN_FLETCHER_AVX2_BLOCK               64
+#define                 HEXIN_FLETCHER_AVX2_NMAX                128
+
+unsigned int hexin_crc32_simd_sse42_support( void );
+unsigned int hexin_crc32c_sse42_init( void );
+unsigned int hexin_crc32c_sse42( unsigned int crc32, const unsigned char *pSrc, unsigned int len );
+
+unsigned int hexin_crc32_fold_clmul( unsigned int crc32, const unsigned char *pSrc, unsigned int len,
+                                     const struct _hexin_crc32 *param );
+
+unsigned int hexin_adler32_ssse3( unsigned int adler, const unsigned char *pSrc, unsigned int len );
+unsigned int hexin_adler32_avx2(  unsigned int adler, const unsigned char *pSrc, unsigned int len );
+unsigned int hexin_fletcher32_avx2( unsigned int fletcher, const unsigned char *pSrc, unsigned int len );
+
+void hexin_crc32_multi_avx2( unsigned int *crc, const unsigned char **pSrc, unsigned int len,
+                             const unsigned int (*table)[MAX_TABLE_ARRAY], unsigned int reflected );
+
+#endif //__CRC32_SIMD_H__
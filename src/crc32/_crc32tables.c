@@ -12,10 +12,46 @@
 *                       2020-03-20 [Heyn] New add hexin_calc_crc32_adler
 *                       2020-03-23 [Heyn] New add hexin_calc_crc32_fletcher
 *                       2020-04-26 [Heyn] Optimized Code
+*                       2026-10-17 [Heyn] New add slicing-by-8 compute
+*                       2026-10-17 [Heyn] New add PCLMULQDQ folding dispatch
+*                       2026-10-17 [Heyn] New add SSE4.2 CRC32-C dispatch
+*                       2026-10-17 [Heyn] Split out hexin_crc32_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] New add hacker table cache, least recently used entry is replaced.
+*                       2026-10-17 [Heyn] New add hexin_crc32_update(), the raw register without init / xorout.
+*                       2026-10-17 [Heyn] New add hexin_crc32_zeros(), runs of zero bytes are skipped in O(log n).
+*                       2026-10-17 [Heyn] New add hexin_crc32_compute_many(), short messages go through the AVX2 lanes.
+*                       2026-10-17 [Heyn] New add hexin_crc32_adler_update(), Adler-32 carried across calls.
+*                       2026-10-17 [Heyn] Adler-32 whole blocks go through the SSSE3 / AVX2 sums.
+*                       2026-10-17 [Heyn] New add hexin_crc32_adler_combine() / hexin_crc32_fletcher_combine().
+*                       2026-10-17 [Heyn] hexin_calc_crc32_fletcher() takes the modulo once per block ( AVX2 / HEXIN_FLETCHER_NMAX words ),
+*                                         New add hexin_crc32_fletcher_sums() / _sums_combine() / _final().
+*                       2026-10-17 [Heyn] hexin_crc32_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
+*                       2026-10-17 [Heyn] hexin_crc32_fletcher_final() takes a 64-bit length.
 *********************************************************************************************************
 */
 
+#include <stdlib.h>
+#include <string.h>
 #include "_crc32tables.h"
+#include "_crc32simd.h"
+
+#if defined( HEXIN_CONST_TABLES )
+#include "_crc32const.h"
+
+static const struct _hexin_crc32_const *hexin_crc32_const_lookup( const struct _hexin_crc32 *param )
+{
+    const struct _hexin_crc32_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_crc32_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
 
 unsigned int hexin_reverse32( unsigned int data )
 {
@@ -88,42 +124,172 @@ unsigned int hexin_crc32_poly_is_low_calc( unsigned int crc32, unsigned char c,
     return crc;
 }
 
-unsigned int hexin_calc_crc32_adler( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ )
+unsigned int hexin_calc_crc32_adler( const unsigned char *pSrc, unsigned int len, unsigned int adler )
 {
-    unsigned int sum1 = 1, sum2 = 0;
-    unsigned int i = 0x00000000L;
+    return hexin_crc32_adler_update( adler, pSrc, len );
+}
+
+/* Adler-32 carried across calls, adler is the previous result ( 1 before any data ). */
+unsigned int hexin_crc32_adler_update( unsigned int adler, const unsigned char *pSrc, unsigned int len )
+{
+    unsigned int sum1 = 0, sum2 = 0;
+    unsigned int size = 0;
+
+    /* Whole vector blocks go through the SIMD sums, the tail through the loop below. */
+    if ( len >= HEXIN_ADLER_AVX2_BLOCK ) {
+        if ( hexin_crc32_simd_avx2_support() ) {
+            size  = len - len % HEXIN_ADLER_AVX2_BLOCK;
+            adler = hexin_adler32_avx2( adler, pSrc, size );
+        } else if ( hexin_crc32_simd_ssse3_support() ) {
+            size  = len - len % HEXIN_ADLER_SSSE3_BLOCK;
+            adler = hexin_adler32_ssse3( adler, pSrc, size );
+        }
+        pSrc += size;
+        len  -= size;
+    }
 
-    for ( i = 0; i < len; i++ ) {
-        sum1 = ( sum1 + pSrc[i] ) % HEXIN_MOD_ADLER;
-        sum2 = ( sum2 + sum1 ) % HEXIN_MOD_ADLER;
+    sum1 = adler & 0xFFFF;
+    sum2 = adler >> 16;
+    while ( len > 0 ) {
+        size = ( len < HEXIN_ADLER_NMAX ) ? len : HEXIN_ADLER_NMAX;
+        len -= size;
+        while ( size-- ) {
+            sum1 += *pSrc++;
+            sum2 += sum1;
+        }
+        sum1 %= HEXIN_MOD_ADLER;
+        sum2 %= HEXIN_MOD_ADLER;
     }
     return ( sum2 << 16 ) | sum1;
 }
 
-unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ )
+/* Same as zlib's adler32_combine(), Adler-32 of a+b from adler1 of a, adler2 of b and len2 = len( b ). */
+unsigned int hexin_crc32_adler_combine( unsigned int adler1, unsigned int adler2, unsigned long long len2 )
 {
-    unsigned long sum1 = 0xFFFF, sum2 = 0xFFFF;
+    unsigned int rem  = ( unsigned int )( len2 % HEXIN_MOD_ADLER );
+    unsigned int sum1 = adler1 & 0xFFFF;
+    unsigned int sum2 = ( rem * sum1 ) % HEXIN_MOD_ADLER;
 
+    sum1 += ( adler2 & 0xFFFF ) + HEXIN_MOD_ADLER - 1;
+    sum2 += ( adler1 >> 16 ) + ( adler2 >> 16 ) + HEXIN_MOD_ADLER - rem;
+    if ( sum1 >= HEXIN_MOD_ADLER ) sum1 -= HEXIN_MOD_ADLER;
+    if ( sum1 >= HEXIN_MOD_ADLER ) sum1 -= HEXIN_MOD_ADLER;
+    if ( sum2 >= ( HEXIN_MOD_ADLER << 1 ) ) sum2 -= ( HEXIN_MOD_ADLER << 1 );
+    if ( sum2 >= HEXIN_MOD_ADLER ) sum2 -= HEXIN_MOD_ADLER;
+
+    return ( sum2 << 16 ) | sum1;
+}
+
+/*
+ * Fletcher-32 sums of the len / 2 whole words mod 65535, returned as sum1 | sum2 << 16 ( 0 .. 65534 ).
+ * Taken mod 65535 once every HEXIN_FLETCHER_NMAX words, AVX2 blocks first.
+ */
+unsigned int hexin_crc32_fletcher_sums( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ )
+{
+    unsigned int sum1 = 0, sum2 = 0;
+    unsigned int size = 0, fletcher = 0;
+    unsigned short word = 0;
+
+    if ( ( len >= HEXIN_FLETCHER_AVX2_BLOCK ) && hexin_crc32_simd_avx2_support() ) {
+        size     = len - len % HEXIN_FLETCHER_AVX2_BLOCK;
+        fletcher = hexin_fletcher32_avx2( fletcher, pSrc, size );
+        pSrc    += size;
+        len     -= size;
+    }
+
+    sum1 = fletcher & 0xFFFF;
+    sum2 = fletcher >> 16;
     while ( len > 1 ) {
-        sum1 += *( unsigned short * )pSrc;
-        sum2 += sum1;
-        sum1 = ( sum1 & 0xFFFF ) + ( sum1 >> 16 );
-        sum2 = ( sum2 & 0xFFFF ) + ( sum2 >> 16 );
-        len  -= 2;
-        pSrc += 2;
+        size = ( len / 2 < HEXIN_FLETCHER_NMAX ) ? len / 2 : HEXIN_FLETCHER_NMAX;
+        len -= size * 2;
+        while ( size-- ) {
+            memcpy( &word, pSrc, 2 );
+            sum1 += word;
+            sum2 += sum1;
+            pSrc += 2;
+        }
+        sum1 %= HEXIN_MOD_FLETCHER;
+        sum2 %= HEXIN_MOD_FLETCHER;
     }
+    return sum1 | ( sum2 << 16 );
+}
 
-    if ( len ) {
-        sum1 += *(unsigned char *) pSrc;
-        sum2 += sum1;
-        sum1 = ( sum1 & 0xFFFF ) + ( sum1 >> 16 );
-        sum2 = ( sum2 & 0xFFFF ) + ( sum2 >> 16 );
+/* Sums of a+b from the ones of a and the ones of b, sum2 gains sum1 of a once per word of b. */
+unsigned int hexin_crc32_fletcher_sums_combine( unsigned int fletcher1, unsigned int fletcher2, unsigned long long len2 )
+{
+    unsigned long long words = ( len2 / 2 ) % HEXIN_MOD_FLETCHER;
+    unsigned long long sum1  = ( unsigned long long )( fletcher1 & 0xFFFF ) + ( fletcher2 & 0xFFFF );
+    unsigned long long sum2  = ( unsigned long long )( fletcher1 >> 16 ) + ( fletcher2 >> 16 ) + words * ( fletcher1 & 0xFFFF );
+
+    return ( unsigned int )( ( sum1 % HEXIN_MOD_FLETCHER ) | ( ( sum2 % HEXIN_MOD_FLETCHER ) << 16 ) );
+}
+
+/* One word of the end-around carry fold hexin_calc_crc32_fletcher() has always used. */
+static void hexin_crc32_fletcher_fold_word( unsigned long *sum1, unsigned long *sum2, unsigned int word )
+{
+    *sum1 += word;
+    *sum2 += *sum1;
+    *sum1 = ( *sum1 & 0xFFFF ) + ( *sum1 >> 16 );
+    *sum2 = ( *sum2 & 0xFFFF ) + ( *sum2 >> 16 );
+}
+
+/*
+ * Fletcher-32 as hexin_calc_crc32_fletcher() returns it, from the sums of the whole words of pSrc.
+ * The fold keeps sum1 in 1 .. 0xFFFF, sum2 too except that it can land on 0x10000 when it is 1
+ * mod 65535 ( shifted out of the result ). That depends on the words before, so from the last
+ * word where sum2 is not 1 the fold is replayed as it was, then the trailing odd byte.
+ */
+unsigned int hexin_crc32_fletcher_final( unsigned int fletcher, const unsigned char *pSrc, unsigned long long len )
+{
+    unsigned long sum1 = fletcher & 0xFFFF, sum2 = fletcher >> 16;
+    unsigned long long words = len / 2, i = words;
+    unsigned short word = 0;
+
+    while ( ( i > 0 ) && ( sum2 == 1 ) ) {
+        i--;
+        memcpy( &word, pSrc + i * 2, 2 );
+        sum2 = ( sum2 + HEXIN_MOD_FLETCHER - sum1 ) % HEXIN_MOD_FLETCHER;
+        sum1 = ( sum1 + HEXIN_MOD_FLETCHER - word % HEXIN_MOD_FLETCHER ) % HEXIN_MOD_FLETCHER;
     }
 
-    return ( sum1 & 0xFFFF ) | ( sum2 << 16 );
+    sum1 = ( sum1 == 0 ) ? 0xFFFF : sum1;
+    sum2 = ( sum2 == 0 ) ? 0xFFFF : sum2;
+    for ( ; i<words; i++ ) {
+        memcpy( &word, pSrc + i * 2, 2 );
+        hexin_crc32_fletcher_fold_word( &sum1, &sum2, word );
+    }
+
+    if ( len & 1 ) {
+        hexin_crc32_fletcher_fold_word( &sum1, &sum2, pSrc[len - 1] );
+    }
+
+    return ( unsigned int )( ( sum1 & 0xFFFF ) | ( sum2 << 16 ) );
+}
+
+unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ )
+{
+    return hexin_crc32_fletcher_final( hexin_crc32_fletcher_sums( pSrc, len, 0 ), pSrc, len );
+}
+
+/*
+ * Fletcher-32 of a+b from fletcher1 of a, fletcher2 of b and len2 = len( b ). Both sums start at
+ * 0xFFFF ( 0 mod 65535 ), so sum1 adds up and sum2 gains sum1 of a once per 16-bit word of b.
+ * a must be a whole number of words, else its last byte would pair with the first of b. A high half
+ * of 0 is a sum2 of 0x10000, 1 mod 65535; the result keeps sum2 in 1 .. 0xFFFF.
+ */
+unsigned int hexin_crc32_fletcher_combine( unsigned int fletcher1, unsigned int fletcher2, unsigned long long len2 )
+{
+    unsigned int high1 = ( ( fletcher1 >> 16 ) == 0 ) ? 1 : ( fletcher1 >> 16 );
+    unsigned int high2 = ( ( fletcher2 >> 16 ) == 0 ) ? 1 : ( fletcher2 >> 16 );
+    unsigned int sums  = hexin_crc32_fletcher_sums_combine( ( fletcher1 & 0xFFFF ) | ( ( high1 % HEXIN_MOD_FLETCHER ) << 16 ),
+                                                            ( fletcher2 & 0xFFFF ) | ( ( high2 % HEXIN_MOD_FLETCHER ) << 16 ),
+                                                            len2 + 1 );
+    unsigned int sum1  = sums & 0xFFFF, sum2 = sums >> 16;
+
+    return ( ( sum1 == 0 ) ? 0xFFFF : sum1 ) | ( ( ( sum2 == 0 ) ? 0xFFFF : sum2 ) << 16 );
 }
 
-unsigned int hexin_crc32_compute_init_table( struct _hexin_crc32 *param )
+unsigned int hexin_crc32_compute_init_table( struct _hexin_crc32 *param, unsigned int polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned int crc = 0x00000000L;
@@ -133,58 +299,456 @@ unsigned int hexin_crc32_compute_init_table( struct _hexin_crc32 *param )
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = i;
             for ( j=0; j<8; j++ ) {
-                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ param->poly;
+                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ polynomial;
                 else                     crc = ( crc >> 1 );
             }
-            param->table[i] = crc;
+            param->table_buffer[0][i] = crc;
+        }
+        /* table[j][i] = CRC of byte i followed by j zero bytes. */
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = param->table_buffer[0][i];
+            for ( j=1; j<HEXIN_CRC32_SLICE_ARRAY; j++ ) {
+                crc = ( crc >> 8 ) ^ param->table_buffer[0][ crc & 0xFF ];
+                param->table_buffer[j][i] = crc;
+            }
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c	= ( ( unsigned int )i ) << 24;
             for ( j=0; j<8; j++ ) {
-                if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ param->poly;
+                if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ polynomial;
                 else                              crc = ( crc << 1 );
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[0][i] = crc;
+        }
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = param->table_buffer[0][i];
+            for ( j=1; j<HEXIN_CRC32_SLICE_ARRAY; j++ ) {
+                crc = ( crc << 8 ) ^ param->table_buffer[0][ crc >> 24 ];
+                param->table_buffer[j][i] = crc;
+            }
         }
     }
+    param->table = ( const unsigned int (*)[MAX_TABLE_ARRAY] )param->table_buffer;
     return TRUE;
 }
 
-unsigned int hexin_crc32_compute_char( unsigned int crc32, unsigned char c, struct _hexin_crc32 *param )
+/*
+ * x^n mod ( x^32 + polynomial ), polynomial in MSB-first form.
+ */
+static unsigned int hexin_crc32_xpow_mod( unsigned int n, unsigned int polynomial )
 {
-    unsigned int crc = crc32;
+    unsigned int r = 0x00000001L;
+
+    while ( n-- ) {
+        if ( r & 0x80000000L ) r = ( r << 1 ) ^ polynomial;
+        else                   r = ( r << 1 );
+    }
+    return r;
+}
+
+/*
+ * Constants for folding a 128-bit block over 512/384/256/128 bits, two per distance:
+ * one for the high-order 64 bits ( x^(d+64) ) and one for the low-order 64 bits ( x^d ).
+ * Each pair is stored in the lane order the block has once loaded, and the reflected
+ * constants are pre-divided by x because a reflected carry-less product comes out one
+ * bit too high.
+ */
+static void hexin_crc32_compute_init_fold( struct _hexin_crc32 *param )
+{
+    static const unsigned int distance[HEXIN_CRC32_FOLD_ARRAY/2] = { 512, 384, 256, 128 };
+    unsigned int i = 0;
+    unsigned int poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-        crc = (crc >> 8) ^ param->table[ ((crc >> 0 ) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
+        for ( i=0; i<HEXIN_CRC32_FOLD_ARRAY/2; i++ ) {
+            param->fold_buffer[2*i+0] = ( unsigned long long )hexin_reverse32( hexin_crc32_xpow_mod( distance[i] + 63, poly ) ) << 32;
+            param->fold_buffer[2*i+1] = ( unsigned long long )hexin_reverse32( hexin_crc32_xpow_mod( distance[i] - 1,  poly ) ) << 32;
+        }
     } else {
-        crc = (crc << 8) ^ param->table[ ((crc >> 24) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
+        for ( i=0; i<HEXIN_CRC32_FOLD_ARRAY/2; i++ ) {
+            param->fold_buffer[2*i+0] = hexin_crc32_xpow_mod( distance[i],      poly );
+            param->fold_buffer[2*i+1] = hexin_crc32_xpow_mod( distance[i] + 64, poly );
+        }
+    }
+    param->fold = param->fold_buffer;
+}
+
+static unsigned int hexin_crc32_compute_slice_ref( unsigned int crc32, const unsigned char *pSrc, unsigned int len,
+                                                   const unsigned int (*table)[MAX_TABLE_ARRAY] )
+{
+    unsigned int crc = crc32;
+
+    while ( len >= 8 ) {
+        crc ^= ( ( unsigned int )pSrc[0]       ) | ( ( unsigned int )pSrc[1] << 8  )
+             | ( ( unsigned int )pSrc[2] << 16 ) | ( ( unsigned int )pSrc[3] << 24 );
+        crc  = table[7][ ( crc       ) & 0xFF ] ^ table[6][ ( crc >> 8  ) & 0xFF ]
+             ^ table[5][ ( crc >> 16 ) & 0xFF ] ^ table[4][ ( crc >> 24 ) & 0xFF ]
+             ^ table[3][ pSrc[4] ] ^ table[2][ pSrc[5] ]
+             ^ table[1][ pSrc[6] ] ^ table[0][ pSrc[7] ];
+        pSrc += 8;
+        len  -= 8;
+    }
+
+    while ( len-- ) {
+        crc = ( crc >> 8 ) ^ table[0][ ( crc ^ *pSrc++ ) & 0xFF ];
     }
 
     return crc;
 }
 
-unsigned int hexin_crc32_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param )
+static unsigned int hexin_crc32_compute_slice( unsigned int crc32, const unsigned char *pSrc, unsigned int len,
+                                               const unsigned int (*table)[MAX_TABLE_ARRAY] )
 {
-    unsigned int i = 0, result = 0;
-    unsigned int crc  = ( param->init << ( HEXIN_CRC32_WIDTH - param->width ) );
+    unsigned int crc = crc32;
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = ( hexin_reverse32( param->poly ) >> ( HEXIN_CRC32_WIDTH - param->width ) );
+    while ( len >= 8 ) {
+        crc ^= ( ( unsigned int )pSrc[0] << 24 ) | ( ( unsigned int )pSrc[1] << 16 )
+             | ( ( unsigned int )pSrc[2] << 8  ) | ( ( unsigned int )pSrc[3]       );
+        crc  = table[7][ ( crc >> 24 ) & 0xFF ] ^ table[6][ ( crc >> 16 ) & 0xFF ]
+             ^ table[5][ ( crc >> 8  ) & 0xFF ] ^ table[4][ ( crc       ) & 0xFF ]
+             ^ table[3][ pSrc[4] ] ^ table[2][ pSrc[5] ]
+             ^ table[1][ pSrc[6] ] ^ table[0][ pSrc[7] ];
+        pSrc += 8;
+        len  -= 8;
+    }
+
+    while ( len-- ) {
+        crc = ( crc << 8 ) ^ table[0][ ( ( crc >> 24 ) ^ *pSrc++ ) & 0xFF ];
+    }
+
+    return crc;
+}
+
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_crc32_compute_init( struct _hexin_crc32 *param )
+{
+    unsigned int poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_crc32_const *entry = NULL;
+#endif
+
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
+    }
+
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_crc32_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->fold  = entry->fold;
+        param->is_initial = TRUE;
+        return TRUE;
+    }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        poly = ( hexin_reverse32( param->poly ) >> ( HEXIN_CRC32_WIDTH - param->width ) );
+    } else {
+        poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
+    }
+    hexin_crc32_compute_init_fold( param );
+    param->is_initial = hexin_crc32_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+/*
+ * a * b mod ( x^32 + polynomial ), MSB-first. A register aligned to bit 31 is a multiple of
+ * x^(32 - width) and stays one, so this is exact for narrower widths too.
+ */
+static unsigned int hexin_crc32_multiply( unsigned int a, unsigned int b, unsigned int polynomial )
+{
+    unsigned int product = 0;
+    unsigned int i = 0;
+
+    for ( i=0; i<32; i++ ) {
+        product = ( product & 0x80000000L ) ? ( ( product << 1 ) ^ polynomial ) : ( product << 1 );
+        if ( a & ( 0x80000000L >> i ) ) {
+            product ^= b;
+        }
+    }
+    return product;
+}
+
+/* Raw register after n zero bytes: multiply by x^(8n), square and multiply. */
+unsigned int hexin_crc32_zeros( unsigned int crc32, unsigned long long n, const struct _hexin_crc32 *param )
+{
+    unsigned int poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
+    unsigned int crc  = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? hexin_reverse32( crc32 ) : crc32;
+    unsigned int xpow = 0x00000001L;
+    unsigned int x8n  = 0x00000100L;
+
+    for ( ; n != 0; n >>= 1 ) {
+        if ( n & 1 ) {
+            xpow = hexin_crc32_multiply( xpow, x8n, poly );
+        }
+        x8n = hexin_crc32_multiply( x8n, x8n, poly );
+    }
+
+    crc = hexin_crc32_multiply( crc, xpow, poly );
+    return HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? hexin_reverse32( crc ) : crc;
+}
+
+/* Number of leading zero bytes, checked 64 bytes at a time. */
+static unsigned int hexin_crc32_zero_run( const unsigned char *pSrc, unsigned int len )
+{
+    unsigned long long w[8];
+    unsigned int n = 0;
+
+    while ( len - n >= sizeof( w ) ) {
+        memcpy( w, pSrc + n, sizeof( w ) );
+        if ( w[0] | w[1] | w[2] | w[3] | w[4] | w[5] | w[6] | w[7] ) {
+            break;
+        }
+        n += sizeof( w );
+    }
+    return n;
+}
+
+static unsigned int hexin_crc32_update_block( unsigned int crc32, const unsigned char *pSrc, unsigned int len,
+                                              const struct _hexin_crc32 *param )
+{
+    unsigned int crc = crc32;
+
+    if ( HEXIN_CRC32_IS_CASTAGNOLI( param ) && hexin_crc32_simd_sse42_support() ) {
+        return hexin_crc32c_sse42( crc, pSrc, len );
+    }
+
+    if ( ( len >= HEXIN_CRC32_FOLD_MINSIZE ) && hexin_crc32_simd_clmul_support() ) {
+        return hexin_crc32_fold_clmul( crc, pSrc, len, param );
+    }
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return hexin_crc32_compute_slice_ref( crc, pSrc, len, param->table );
+    }
+    return hexin_crc32_compute_slice( crc, pSrc, len, param->table );
+}
+
+/*
+ * Run the raw register over pSrc: MSB-first registers are aligned to bit 31, reflected
+ * ones to bit 0. No init or xorout is applied.
+ * Runs of HEXIN_CRC32_ZERO_MINSIZE zero bytes or more are skipped with hexin_crc32_zeros().
+ */
+unsigned int hexin_crc32_update( unsigned int crc32, const unsigned char *pSrc, unsigned int len, const struct _hexin_crc32 *param )
+{
+    unsigned int crc = crc32;
+    unsigned int size = 0;
+
+    while ( len >= HEXIN_CRC32_ZERO_MINSIZE ) {
+        size = hexin_crc32_zero_run( pSrc, len );
+        if ( size >= HEXIN_CRC32_ZERO_MINSIZE ) {
+            crc = hexin_crc32_zeros( crc, size, param );
         } else {
-            param->poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
+            size = HEXIN_CRC32_ZERO_MINSIZE;
+            crc  = hexin_crc32_update_block( crc, pSrc, size, param );
         }
-        param->is_initial = hexin_crc32_compute_init_table( param );
+        pSrc += size;
+        len  -= size;
     }
 
-	for ( i=0; i<len; i++ ) {
-		crc = hexin_crc32_compute_char( crc, pSrc[i], param );
-	}
+    return hexin_crc32_update_block( crc, pSrc, len, param );
+}
+
+unsigned int hexin_crc32_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc32 *param )
+{
+    unsigned int result = 0;
+    unsigned int crc  = ( param->init << ( HEXIN_CRC32_WIDTH - param->width ) );
+
+    while ( len > HEXIN_CRC32_UPDATE_MAXSIZE ) {
+        crc   = hexin_crc32_update( crc, pSrc, HEXIN_CRC32_UPDATE_MAXSIZE, param );
+        pSrc += HEXIN_CRC32_UPDATE_MAXSIZE;
+        len  -= HEXIN_CRC32_UPDATE_MAXSIZE;
+    }
+    crc = hexin_crc32_update( crc, pSrc, ( unsigned int )len, param );
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        result = crc;
+    } else {
+        result = ( crc >> ( HEXIN_CRC32_WIDTH - param->width ) );
+    }
 
-    result = ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) ? crc : ( crc >> ( HEXIN_CRC32_WIDTH - param->width ) );
-    
 	return ( result ^ param->xorout ); 
 }
+
+struct _hexin_crc32_lane {
+    unsigned int len;
+    unsigned int index;
+};
+
+static int hexin_crc32_lane_compare( const void *a, const void *b )
+{
+    unsigned int x = ( ( const struct _hexin_crc32_lane * )a )->len;
+    unsigned int y = ( ( const struct _hexin_crc32_lane * )b )->len;
+
+    return ( x > y ) - ( x < y );
+}
+
+/*
+ * CRC of count independent messages. Short ones are sorted by length and run HEXIN_CRC32_LANES at a
+ * time for the length of the shortest in the group, each then finishes its own tail. CRC32-C stays
+ * on the crc32 instruction, which is faster per message than a lane.
+ */
+void hexin_crc32_compute_many( const unsigned char *const *pSrc, const unsigned int *len, unsigned int count,
+                               const struct _hexin_crc32 *param, unsigned int *result )
+{
+    struct _hexin_crc32_lane order[HEXIN_CRC32_MULTI_CHUNK];
+    const unsigned char *lane[HEXIN_CRC32_LANES];
+    unsigned int crc[HEXIN_CRC32_LANES];
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+    unsigned int offset = HEXIN_CRC32_WIDTH - param->width;
+    unsigned int base = 0, size = 0, n = 0, i = 0, l = 0, shortest = 0, sorted = TRUE, value = 0;
+
+    if ( ( count < HEXIN_CRC32_LANES ) || !hexin_crc32_simd_avx2_support()
+         || ( HEXIN_CRC32_IS_CASTAGNOLI( param ) && hexin_crc32_simd_sse42_support() ) ) {
+        for ( i=0; i<count; i++ ) {
+            result[i] = hexin_crc32_compute( pSrc[i], len[i], param );
+        }
+        return;
+    }
+
+    for ( base=0; base<count; base+=size ) {
+        size   = ( count - base < HEXIN_CRC32_MULTI_CHUNK ) ? ( count - base ) : HEXIN_CRC32_MULTI_CHUNK;
+        sorted = TRUE;
+        for ( i=0, n=0; i<size; i++ ) {
+            if ( len[base + i] >= HEXIN_CRC32_MULTI_MAXSIZE ) {
+                result[base + i] = hexin_crc32_compute( pSrc[base + i], len[base + i], param );
+                continue;
+            }
+            order[n].len   = len[base + i];
+            order[n].index = base + i;
+            if ( ( n > 0 ) && ( order[n].len < order[n - 1].len ) ) {
+                sorted = FALSE;
+            }
+            n++;
+        }
+        if ( !sorted ) {
+            qsort( order, n, sizeof( order[0] ), hexin_crc32_lane_compare );
+        }
+
+        for ( i=0; i+HEXIN_CRC32_LANES<=n; i+=HEXIN_CRC32_LANES ) {
+            for ( l=0; l<HEXIN_CRC32_LANES; l++ ) {
+                lane[l] = pSrc[order[i + l].index];
+                crc[l]  = param->init << offset;
+            }
+            shortest = order[i].len & ~3U;
+            hexin_crc32_multi_avx2( crc, lane, shortest, param->table, reflected );
+            for ( l=0; l<HEXIN_CRC32_LANES; l++ ) {
+                value = hexin_crc32_update( crc[l], lane[l], order[i + l].len - shortest, param );
+                result[order[i + l].index] = ( reflected ? value : ( value >> offset ) ) ^ param->xorout;
+            }
+        }
+        for ( ; i<n; i++ ) {
+            result[order[i].index] = hexin_crc32_compute( pSrc[order[i].index], order[i].len, param );
+        }
+    }
+}
+
+/*
+ * Tables built for hacker parameters, keyed by ( width, poly, refin, refout ).
+ * There is no lock, the module only calls in here with the GIL held. An entry in
+ * use by a computation running without the GIL is never replaced.
+ */
+static struct _hexin_crc32_cache {
+    unsigned int        valid;
+    unsigned int        refs;
+    unsigned long long  used;
+    struct _hexin_crc32  param;
+} hexin_crc32_cache[HEXIN_CRC32_CACHE_SIZE];
+
+static unsigned long long hexin_crc32_cache_tick   = 0;
+static unsigned long long hexin_crc32_cache_hits   = 0;
+static unsigned long long hexin_crc32_cache_misses = 0;
+
+/*
+ * Point param at a cached table, building it on a miss. Returns the handle to pass to
+ * hexin_crc32_cache_release(), or 0 when every entry is in use and param got its own table.
+ */
+unsigned int hexin_crc32_cache_acquire( struct _hexin_crc32 *param )
+{
+    struct _hexin_crc32_cache *slot  = NULL;
+    struct _hexin_crc32_cache *entry = NULL;
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC32_CACHE_SIZE; i++ ) {
+        entry = &hexin_crc32_cache[i];
+        if ( entry->valid && ( entry->param.width == param->width ) && ( entry->param.poly   == param->poly  )
+                          && ( entry->param.refin == param->refin ) && ( entry->param.refout == param->refout ) ) {
+            slot = entry;
+            break;
+        }
+    }
+
+    if ( slot != NULL ) {
+        hexin_crc32_cache_hits++;
+    } else {
+        hexin_crc32_cache_misses++;
+        for ( i=0; i<HEXIN_CRC32_CACHE_SIZE; i++ ) {
+            entry = &hexin_crc32_cache[i];
+            if ( entry->refs != 0 ) {
+                continue;
+            }
+            if ( !entry->valid ) {
+                slot = entry;
+                break;
+            }
+            if ( ( slot == NULL ) || ( entry->used < slot->used ) ) {
+                slot = entry;
+            }
+        }
+
+        if ( slot == NULL ) {
+            hexin_crc32_compute_init( param );
+            return 0;
+        }
+
+        slot->valid             = FALSE;
+        slot->param.is_initial  = FALSE;
+        slot->param.width       = param->width;
+        slot->param.poly        = param->poly;
+        slot->param.refin       = param->refin;
+        slot->param.refout      = param->refout;
+        slot->valid = hexin_crc32_compute_init( &slot->param );
+    }
+
+    slot->used = ++hexin_crc32_cache_tick;
+    slot->refs++;
+    param->table = slot->param.table;
+    param->fold  = slot->param.fold;
+    param->is_initial = TRUE;
+    return ( unsigned int )( slot - hexin_crc32_cache ) + 1;
+}
+
+void hexin_crc32_cache_release( unsigned int handle )
+{
+    if ( ( handle > 0 ) && ( handle <= HEXIN_CRC32_CACHE_SIZE ) && ( hexin_crc32_cache[handle - 1].refs > 0 ) ) {
+        hexin_crc32_cache[handle - 1].refs--;
+    }
+}
+
+void hexin_crc32_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count )
+{
+    unsigned int i = 0;
+
+    *hits   = hexin_crc32_cache_hits;
+    *misses = hexin_crc32_cache_misses;
+    *count  = 0;
+    for ( i=0; i<HEXIN_CRC32_CACHE_SIZE; i++ ) {
+        *count += hexin_crc32_cache[i].valid ? 1 : 0;
+    }
+}
+
+/* Drops every entry not in use and resets the counters. */
+void hexin_crc32_cache_clear( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC32_CACHE_SIZE; i++ ) {
+        if ( hexin_crc32_cache[i].refs == 0 ) {
+            hexin_crc32_cache[i].valid = FALSE;
+        }
+    }
+    hexin_crc32_cache_hits   = 0;
+    hexin_crc32_cache_misses = 0;
+}
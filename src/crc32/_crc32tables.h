@@ -10,6 +10,18 @@
 * ---------------
 *		New Create at 	2020-03-17 [Heyn] Initialize.
 *                       2020-04-26 [Heyn] Optimized Code.
+*                       2026-10-17 [Heyn] New add slicing-by-8 tables.
+*                       2026-10-17 [Heyn] New add PCLMULQDQ fold constants.
+*                       2026-10-17 [Heyn] New add hexin_crc32_compute_init().
+*                       2026-10-17 [Heyn] Catalogue tables come from the generated _crc32const.h.
+*                       2026-10-17 [Heyn] New add hacker table cache.
+*                       2026-10-17 [Heyn] New add hexin_crc32_update().
+*                       2026-10-17 [Heyn] New add hexin_crc32_zeros() and HEXIN_CRC32_ZERO_MINSIZE.
+*                       2026-10-17 [Heyn] New add hexin_crc32_compute_many(), short messages go through the AVX2 lanes.
+*                       2026-10-17 [Heyn] New add hexin_crc32_adler_update(), Adler-32 carried across calls.
+*                       2026-10-17 [Heyn] hexin_calc_crc32_adler() takes the previous value, ( 1 to start ).
+*                       2026-10-17 [Heyn] New add hexin_crc32_adler_combine() / hexin_crc32_fletcher_combine().
+*                       2026-10-17 [Heyn] New add HEXIN_FLETCHER_NMAX, hexin_crc32_fletcher_sums() / _sums_combine() / _final().
 *********************************************************************************************************
 */
 
@@ -29,9 +41,33 @@
 #endif
 
 #define                 HEXIN_MOD_ADLER                         65521
+/* Largest n with 255 * n * ( n + 1 ) / 2 + ( n + 1 ) * ( HEXIN_MOD_ADLER - 1 ) < 2^32, the sums can wait that long for the modulo. */
+#define                 HEXIN_ADLER_NMAX                        5552
+#define                 HEXIN_MOD_FLETCHER                      65535
+/* Largest n with 65535 * ( n + 1 ) * ( n + 2 ) / 2 < 2^32, words the Fletcher-32 sums can take between two modulos. */
+#define                 HEXIN_FLETCHER_NMAX                     360
 
 #define                 HEXIN_CRC32_WIDTH                       32
 
+/* Number of hacker parameter tables kept by hexin_crc32_cache_acquire(). */
+#ifndef HEXIN_CRC32_CACHE_SIZE
+#define                 HEXIN_CRC32_CACHE_SIZE                  16
+#endif
+
+/* Runs of at least this many zero bytes are skipped rather than computed. */
+#ifndef HEXIN_CRC32_ZERO_MINSIZE
+#define                 HEXIN_CRC32_ZERO_MINSIZE                0x10000
+#endif
+
+#ifndef HEXIN_CRC32_SLICE_ARRAY
+#define                 HEXIN_CRC32_SLICE_ARRAY                 8
+#endif
+
+#define                 HEXIN_CRC32_FOLD_ARRAY                  8
+
+/* hexin_crc32_compute() feeds hexin_crc32_update() at most this many bytes at a time. */
+#define                 HEXIN_CRC32_UPDATE_MAXSIZE              0x40000000
+
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x80000000L )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 
@@ -49,7 +85,19 @@ struct _hexin_crc32 {
     unsigned int  refout;
     unsigned int  xorout;
     unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
+    const unsigned int  (*table)[MAX_TABLE_ARRAY];
+    const unsigned long long  *fold;
+    unsigned int  table_buffer[HEXIN_CRC32_SLICE_ARRAY][MAX_TABLE_ARRAY];
+    unsigned long long  fold_buffer[HEXIN_CRC32_FOLD_ARRAY];
+};
+
+/* One entry of the generated _crc32const.h ( see src/gentables.py ). */
+struct _hexin_crc32_const {
+    unsigned int  width;
+    unsigned int  poly;
+    unsigned int  reflected;
+    const unsigned int  (*table)[MAX_TABLE_ARRAY];
+    const unsigned long long  *fold;
 };
 
 
@@ -58,8 +106,24 @@ unsigned int hexin_reverse32( unsigned int data );
 unsigned int hexin_crc32_init_table_poly_is_high( unsigned int polynomial, unsigned int *table );
 unsigned int hexin_crc32_init_table_poly_is_low(  unsigned int polynomial, unsigned int *table );
 
-unsigned int hexin_calc_crc32_adler(    const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
+unsigned int hexin_calc_crc32_adler(    const unsigned char *pSrc, unsigned int len, unsigned int adler );
 unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
-unsigned int hexin_crc32_compute(       const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param );
+unsigned int hexin_crc32_adler_update(  unsigned int adler, const unsigned char *pSrc, unsigned int len );
+unsigned int hexin_crc32_adler_combine(    unsigned int adler1,    unsigned int adler2,    unsigned long long len2 );
+unsigned int hexin_crc32_fletcher_combine( unsigned int fletcher1, unsigned int fletcher2, unsigned long long len2 );
+unsigned int hexin_crc32_fletcher_sums( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
+unsigned int hexin_crc32_fletcher_sums_combine( unsigned int fletcher1, unsigned int fletcher2, unsigned long long len2 );
+unsigned int hexin_crc32_fletcher_final( unsigned int fletcher, const unsigned char *pSrc, unsigned long long len );
+unsigned int hexin_crc32_compute_init( struct _hexin_crc32 *param );
+unsigned int hexin_crc32_compute(       const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc32 *param );
+void hexin_crc32_compute_many( const unsigned char *const *pSrc, const unsigned int *len, unsigned int count,
+                               const struct _hexin_crc32 *param, unsigned int *result );
+unsigned int hexin_crc32_update( unsigned int crc32, const unsigned char *pSrc, unsigned int len, const struct _hexin_crc32 *param );
+unsigned int hexin_crc32_zeros( unsigned int crc32, unsigned long long n, const struct _hexin_crc32 *param );
+
+unsigned int hexin_crc32_cache_acquire( struct _hexin_crc32 *param );
+void hexin_crc32_cache_release( unsigned int handle );
+void hexin_crc32_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count );
+void hexin_crc32_cache_clear( void );
 
 #endif //__CRC32_TABLES_H__
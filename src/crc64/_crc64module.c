@@ -14,34 +14,67 @@
 *                       2020-03-16 [Heyn] New add hacker64 code.
 *                       2020-04-17 [Heyn] Issues #1
 *                       2020-04-23 [Heyn] New add we() and xz() functions.
+*                       2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+*                       2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+*                       2026-10-17 [Heyn] hacker64 tables come from an LRU cache, New add _cache_info() / _cache_clear().
+*                       2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+*                       2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+*                       2026-10-17 [Heyn] New add libscrc.nvme64() ( CRC-64/NVME ) and nvme64_blocks().
+*                       2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+*                       2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
+*                       2026-10-17 [Heyn] Fix nvme64_blocks() over 4 GB of data, the block count is 64-bit.
 *
 *********************************************************************************************************
 */
 
 #include <Python.h>
 #include "_crc64tables.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc64 *param )
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_crc64 *param, unsigned long long *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned long long )value;
+        } else {
+            *result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -49,94 +82,188 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc64_iso( PyObject *self, PyObject *args )
+static struct _hexin_crc64 crc64_param_goiso = { .is_initial=FALSE,
+                                                 .width  = HEXIN_CRC64_WIDTH,
+                                                 .poly   = 0x000000000000001BL,
+                                                 .init   = 0xFFFFFFFFFFFFFFFFL,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                                 .result = 0 };
+
+static PyObject * _crc64_iso( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc64 crc64_param_goiso = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC64_WIDTH,
-                                                     .poly   = 0x000000000000001BL,
-                                                     .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                     .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_goiso ) ) {
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc64_param_goiso, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_goiso.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_ecma182( PyObject *self, PyObject *args )
+static struct _hexin_crc64 crc64_param_ecma = { .is_initial=FALSE,
+                                                .width  = HEXIN_CRC64_WIDTH,
+                                                .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                                .init   = 0x0000000000000000L,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x0000000000000000L,
+                                                .result = 0 };
+
+static PyObject * _crc64_ecma182( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc64 crc64_param_ecma = { .is_initial=FALSE,
-                                                    .width  = HEXIN_CRC64_WIDTH,
-                                                    .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                    .init   = 0x0000000000000000L,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x0000000000000000L,
-                                                    .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_ecma ) ) {
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc64_param_ecma, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_ecma.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_we( PyObject *self, PyObject *args )
+static struct _hexin_crc64 crc64_param_we = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC64_WIDTH,
+                                              .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                              .init   = 0xFFFFFFFFFFFFFFFFL,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                              .result = 0 };
+
+static PyObject * _crc64_we( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc64_param_we, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static struct _hexin_crc64 crc64_param_xz = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC64_WIDTH,
+                                              .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                              .init   = 0xFFFFFFFFFFFFFFFFL,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                              .result = 0 };
+
+static PyObject * _crc64_xz( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc64 crc64_param_we = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC64_WIDTH,
-                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                  .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_we ) ) {
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc64_param_xz, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_we.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_xz( PyObject *self, PyObject *args )
+static struct _hexin_crc64 crc64_param_gsm = { .is_initial=FALSE,
+                                               .width  = 40,
+                                               .poly   = 0x0004820009,
+                                               .init   = 0x0000000000,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0xFFFFFFFFFFL,
+                                               .result = 0 };
+
+static PyObject * _crc64_gsm40( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc64 crc64_param_xz = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC64_WIDTH,
-                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                  .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                  .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_xz ) ) {
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc64_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_xz.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_gsm40( PyObject *self, PyObject *args )
+static struct _hexin_crc64 crc64_param_nvme = { .is_initial=FALSE,
+                                                .width  = HEXIN_CRC64_WIDTH,
+                                                .poly   = CRC64_POLYNOMIAL_NVME,
+                                                .init   = 0xFFFFFFFFFFFFFFFFL,
+                                                .refin  = TRUE,
+                                                .refout = TRUE,
+                                                .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                                .result = 0 };
+
+static PyObject * _crc64_nvme( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc64 crc64_param_gsm = { .is_initial=FALSE,
-                                                   .width  = 40,
-                                                   .poly   = 0x0004820009,
-                                                   .init   = 0x0000000000,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFFFFFFFFFFL,
-                                                   .result = 0 };
-
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_gsm ) ) {
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc64_param_nvme, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_gsm.result );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+/* The guard of every block_size bytes as array('Q'). */
+static PyObject * _crc64_nvme_blocks( PyObject *self, PyObject *args, PyObject *kws )
+{
+    Py_buffer data = { NULL, NULL };
+    Py_ssize_t block_size = 4096;
+    PyObject *guards = NULL, *array = NULL, *result = NULL;
+
+    static char* kwlist[]={ "data", "block_size", NULL };
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|n", kwlist, &data, &block_size ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#else
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|n", kwlist, &data, &block_size ) ) {
+        if ( data.obj ) {
+            PyBuffer_Release( &data );
+        }
+        return NULL;
+    }
+#endif /* PY_MAJOR_VERSION */
+
+    if ( ( block_size <= 0 ) || ( ( unsigned long long )block_size > 0xFFFFFFFFULL ) ) {
+        PyErr_SetString( PyExc_ValueError, "block_size must be 1 to 0xFFFFFFFF bytes" );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( data.len % block_size != 0 ) {
+        PyErr_SetString( PyExc_ValueError, "data must be a whole number of block_size bytes" );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    guards = PyBytes_FromStringAndSize( NULL, ( data.len / block_size ) * sizeof( unsigned long long ) );
+    if ( guards == NULL ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        hexin_crc64_compute_blocks( (const unsigned char *)data.buf, (unsigned long long)data.len, (unsigned int)block_size,
+                                    &crc64_param_nvme, (unsigned long long *)PyBytes_AS_STRING( guards ) );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_crc64_compute_blocks( (const unsigned char *)data.buf, (unsigned long long)data.len, (unsigned int)block_size,
+                                    &crc64_param_nvme, (unsigned long long *)PyBytes_AS_STRING( guards ) );
+    }
+    PyBuffer_Release( &data );
+
+    array = PyImport_ImportModule( "array" );
+    if ( array != NULL ) {
+        result = PyObject_CallMethod( array, "array", "sO", "Q", guards );
+        Py_DECREF( array );
+    }
+    Py_DECREF( guards );
+
+    return result;
 }
 
 static PyObject * _crc64_table( PyObject *self, PyObject *args )
@@ -162,15 +289,16 @@ static PyObject * _crc64_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "K", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLongLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc64_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc64_hacker( HEXIN_FASTCALL_PARAMS )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int cache = 0;
     struct _hexin_crc64 crc64_param_hacker = { .is_initial=FALSE,
                                                .width  = HEXIN_CRC64_WIDTH,
                                                .poly   = CRC64_POLYNOMIAL_ECMA182,
@@ -179,57 +307,145 @@ static PyObject * _crc64_hacker( PyObject *self, PyObject *args, PyObject* kws )
                                                .refout = FALSE,
                                                .xorout = 0x0000000000000000L,
                                                .result = 0 };
+    unsigned long long poly   = crc64_param_hacker.poly;
+    unsigned long long init   = crc64_param_hacker.init;
+    unsigned long long xorout = crc64_param_hacker.xorout;
+    PyObject *slots[6];
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    static const char *const kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|KKKpp", kwlist, &data,
-                                                                      &crc64_param_hacker.poly,
-                                                                      &crc64_param_hacker.init,
-                                                                      &crc64_param_hacker.xorout,
-                                                                      &crc64_param_hacker.refin,
-                                                                      &crc64_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL; 
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 6, slots )
+      || !hexin_PyArg_Mask( slots[1], &poly ) || !hexin_PyArg_Mask( slots[2], &init ) || !hexin_PyArg_Mask( slots[3], &xorout )
+      || !hexin_PyArg_Bool( slots[4], &crc64_param_hacker.refin ) || !hexin_PyArg_Bool( slots[5], &crc64_param_hacker.refout )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
+        return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|KKKpp", kwlist, &data,
-                                                                      &crc64_param_hacker.poly,
-                                                                      &crc64_param_hacker.init,
-                                                                      &crc64_param_hacker.xorout,
-                                                                      &crc64_param_hacker.refin,
-                                                                      &crc64_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL; 
+    crc64_param_hacker.poly   = ( unsigned long long )poly;
+    crc64_param_hacker.init   = ( unsigned long long )init;
+    crc64_param_hacker.xorout = ( unsigned long long )xorout;
+
+    cache = hexin_crc64_cache_acquire( &crc64_param_hacker );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        crc64_param_hacker.result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc64_param_hacker );
+        Py_END_ALLOW_THREADS
+    } else {
+        crc64_param_hacker.result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc64_param_hacker );
     }
-#endif /* PY_MAJOR_VERSION */
 
-    crc64_param_hacker.result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc64_param_hacker );
+    hexin_crc64_cache_release( cache );
 
     if ( data.obj )
        PyBuffer_Release( &data );
 
-    return Py_BuildValue( "K", crc64_param_hacker.result );
+    return PyLong_FromUnsignedLongLong( crc64_param_hacker.result );
+}
+
+static PyObject * _crc64_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
+        return NULL;
+    }
+
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+static PyObject * _crc64_cache_info( PyObject *self, PyObject *args )
+{
+    unsigned long long hits = 0, misses = 0;
+    unsigned int count = 0;
+
+    hexin_crc64_cache_info( &hits, &misses, &count );
+    return Py_BuildValue( "KKII", hits, misses, ( unsigned int )HEXIN_CRC64_CACHE_SIZE, count );
+}
+
+static PyObject * _crc64_cache_clear( PyObject *self, PyObject *args )
+{
+    hexin_crc64_cache_clear();
+    Py_RETURN_NONE;
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_crc64_catalogue {
+    const char          *name;
+    struct _hexin_crc64  *param;
+} hexin_crc64_params[] = {
+    { "iso",     &crc64_param_goiso },
+    { "ecma182", &crc64_param_ecma },
+    { "we",      &crc64_param_we },
+    { "xz64",    &crc64_param_xz },
+    { "gsm40",   &crc64_param_gsm },
+    { "nvme64",  &crc64_param_nvme },
+    { NULL, NULL }
+};
+
+static void hexin_crc64_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_crc64_params[i].name != NULL; i++ ) {
+        hexin_crc64_compute_init( hexin_crc64_params[i].param );
+    }
+}
+
+static PyObject * _crc64_catalogue( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( pdict == NULL ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc64_params[i].name != NULL; i++ ) {
+        param = hexin_crc64_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_crc64_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
 }
 
 /* method table */
 static PyMethodDef _crc64Methods[] = {
-    { "iso",         (PyCFunction)_crc64_iso,     METH_VARARGS, "Calculate GO-IOS of CRC64 [Poly=0x000000000000001BL, Init=0xFFFFFFFFFFFFFFFFL, refin=True,  refout=True,  xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "ecma182",     (PyCFunction)_crc64_ecma182, METH_VARARGS, "Calculate ECMA182 of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0x0000000000000000, refin=False, refout=False, xorout=0x0000000000000000]" },
-    { "we",          (PyCFunction)_crc64_we,      METH_VARARGS, "Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "xz64",        (PyCFunction)_crc64_xz,      METH_VARARGS, "Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "gsm40",       (PyCFunction)_crc64_gsm40,   METH_VARARGS, "Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF ]" },
+    { "iso",         (PyCFunction)_crc64_iso,     HEXIN_METH_FASTCALL, "Calculate GO-IOS of CRC64 [Poly=0x000000000000001BL, Init=0xFFFFFFFFFFFFFFFFL, refin=True,  refout=True,  xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "ecma182",     (PyCFunction)_crc64_ecma182, HEXIN_METH_FASTCALL, "Calculate ECMA182 of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0x0000000000000000, refin=False, refout=False, xorout=0x0000000000000000]" },
+    { "we",          (PyCFunction)_crc64_we,      HEXIN_METH_FASTCALL, "Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "xz64",        (PyCFunction)_crc64_xz,      HEXIN_METH_FASTCALL, "Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "gsm40",       (PyCFunction)_crc64_gsm40,   HEXIN_METH_FASTCALL, "Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF ]" },
+    { "nvme64",      (PyCFunction)_crc64_nvme,    HEXIN_METH_FASTCALL, "Calculate NVME of CRC64 [Poly=0xAD93D23594C93659L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "nvme64_blocks", (PyCFunction)_crc64_nvme_blocks, METH_KEYWORDS|METH_VARARGS, "NVME CRC64 of every block, nvme64_blocks( data, block_size=4096 ) -> array('Q')" },
     { "table64",     (PyCFunction)_crc64_table,   METH_VARARGS, "Print CRC64 table to list. libscrc.table64( polynomial )" },
-    { "hacker64",    (PyCFunction)_crc64_hacker,  METH_KEYWORDS|METH_VARARGS, "User calculation CRC64\n"
+    { "hacker64",    (PyCFunction)_crc64_hacker,  HEXIN_METH_FASTCALL, "User calculation CRC64\n"
                                                                               "@data   : bytes\n"
                                                                               "@poly   : default=0x42F0E1EBA9EA3693\n"
                                                                               "@init   : default=0x0000000000000000\n"
                                                                               "@xorout : default=0x0000000000000000\n"
                                                                               "@ref    : default=False" },
+    { "_gil_threshold", (PyCFunction)_crc64_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_crc64_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
+    { "_cache_info",  (PyCFunction)_crc64_cache_info,  METH_NOARGS, "hacker64 table cache (hits, misses, maxsize, currsize)" },
+    { "_cache_clear", (PyCFunction)_crc64_cache_clear, METH_NOARGS, "Empty the hacker64 table cache and reset its counters" },
     {NULL, NULL, 0, NULL}        /* Sentinel */
 };
 
@@ -242,6 +458,8 @@ PyDoc_STRVAR(_crc64_doc,
 "libscrc.we       -> Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]\n"
 "libscrc.xz64     -> Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]\n"
 "libscrc.gsm40    -> Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF]\n"
+"libscrc.nvme64   -> Calculate NVME of CRC64 [Poly=0xAD93D23594C93659L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]\n"
+"libscrc.nvme64_blocks -> NVME CRC64 of every block_size bytes as array('Q')\n"
 "libscrc.hacker64 -> Free calculation CRC64 Xorout=0 Refin=False Refout=False\n"
 "\n");
 
@@ -263,6 +481,8 @@ PyInit__crc64(void)
 {
     PyObject *m;
 
+    hexin_crc64_params_init();
+
     m = PyModule_Create( &_crc64module );
     if ( m == NULL ) {
         return NULL;
@@ -280,6 +500,7 @@ PyInit__crc64(void)
 PyMODINIT_FUNC
 init_crc64(void)
 {
+    hexin_crc64_params_init();
     (void) Py_InitModule3( "_crc64", _crc64Methods, _crc64_doc );
 }
 
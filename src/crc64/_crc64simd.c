@@ -0,0 +1,151 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _crc64simd.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. PCLMULQDQ folding for any 64-bit polynomial.
+*                      2026-10-17 [Heyn] CPUID / XGETBV and the target attributes moved to _modelcpuid.h, only the kernels are left here.
+*
+*   SEE : Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+*
+*********************************************************************************************************
+*/
+
+#include "_crc64simd.h"
+
+#if defined( HEXIN_X86_SIMD )
+
+#include <immintrin.h>
+
+unsigned int hexin_crc64_simd_clmul_support( void )
+{
+    static int support = -1;
+    unsigned int mask  = HEXIN_CPUID_ECX_SSSE3 | HEXIN_CPUID_ECX_PCLMULQDQ;
+
+    if ( support < 0 ) {
+        support = ( ( hexin_cpuid_ecx() & mask ) == mask ) ? TRUE : FALSE;
+    }
+    return ( unsigned int )support;
+}
+
+/* Same as hexin_crc32_fold128(), the lanes of k come from hexin_crc64_compute_init_fold(). */
+static HEXIN_TARGET_CLMUL __m128i hexin_crc64_fold128( __m128i x, __m128i k )
+{
+    return _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ), _mm_clmulepi64_si128( x, k, 0x11 ) );
+}
+
+HEXIN_TARGET_CLMUL
+unsigned long long hexin_crc64_fold_clmul( unsigned long long crc64, const unsigned char *pSrc, unsigned int len,
+                                           const struct _hexin_crc64 *param )
+{
+    unsigned int i = 0;
+    unsigned long long crc = 0;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param );
+    unsigned char remainder[16];
+    const __m128i bswap = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+    const __m128i k512  = _mm_set_epi64x( ( long long )param->fold[1], ( long long )param->fold[0] );
+    const __m128i k384  = _mm_set_epi64x( ( long long )param->fold[3], ( long long )param->fold[2] );
+    const __m128i k256  = _mm_set_epi64x( ( long long )param->fold[5], ( long long )param->fold[4] );
+    const __m128i k128  = _mm_set_epi64x( ( long long )param->fold[7], ( long long )param->fold[6] );
+    __m128i x0, x1, x2, x3, b0, b1, b2, b3;
+
+    /* The register is the CRC of nothing, so it just gets xored onto the first eight bytes. */
+    if ( reflected ) {
+        x0 = _mm_xor_si128( _mm_loadu_si128( ( const __m128i * )pSrc ), _mm_set_epi64x( 0, ( long long )crc64 ) );
+    } else {
+        x0 = _mm_shuffle_epi8( _mm_loadu_si128( ( const __m128i * )pSrc ), bswap );
+        x0 = _mm_xor_si128( x0, _mm_set_epi64x( ( long long )crc64, 0 ) );
+    }
+    pSrc += 16;
+    len  -= 16;
+
+    if ( len >= 112 ) {
+        x1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+        x2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+        x3 = _mm_loadu_si128( ( const __m128i * )( pSrc + 32 ) );
+        if ( !reflected ) {
+            x1 = _mm_shuffle_epi8( x1, bswap );
+            x2 = _mm_shuffle_epi8( x2, bswap );
+            x3 = _mm_shuffle_epi8( x3, bswap );
+        }
+        pSrc += 48;
+        len  -= 48;
+
+        while ( len >= 64 ) {
+            b0 = _mm_loadu_si128( ( const __m128i * )( pSrc + 0  ) );
+            b1 = _mm_loadu_si128( ( const __m128i * )( pSrc + 16 ) );
+            b2 = _mm_loadu_si128( ( const __m128i * )( pSrc + 32 ) );
+            b3 = _mm_loadu_si128( ( const __m128i * )( pSrc + 48 ) );
+            if ( !reflected ) {
+                b0 = _mm_shuffle_epi8( b0, bswap );
+                b1 = _mm_shuffle_epi8( b1, bswap );
+                b2 = _mm_shuffle_epi8( b2, bswap );
+                b3 = _mm_shuffle_epi8( b3, bswap );
+            }
+            x0 = _mm_xor_si128( hexin_crc64_fold128( x0, k512 ), b0 );
+            x1 = _mm_xor_si128( hexin_crc64_fold128( x1, k512 ), b1 );
+            x2 = _mm_xor_si128( hexin_crc64_fold128( x2, k512 ), b2 );
+            x3 = _mm_xor_si128( hexin_crc64_fold128( x3, k512 ), b3 );
+            pSrc += 64;
+            len  -= 64;
+        }
+
+        x0 = _mm_xor_si128( hexin_crc64_fold128( x0, k384 ), hexin_crc64_fold128( x1, k256 ) );
+        x0 = _mm_xor_si128( x0, hexin_crc64_fold128( x2, k128 ) );
+        x0 = _mm_xor_si128( x0, x3 );
+    }
+
+    while ( len >= 16 ) {
+        b0 = _mm_loadu_si128( ( const __m128i * )pSrc );
+        if ( !reflected ) {
+            b0 = _mm_shuffle_epi8( b0, bswap );
+        }
+        x0 = _mm_xor_si128( hexin_crc64_fold128( x0, k128 ), b0 );
+        pSrc += 16;
+        len  -= 16;
+    }
+
+    /* x0 is congruent to everything folded so far, its CRC is the register. */
+    if ( !reflected ) {
+        x0 = _mm_shuffle_epi8( x0, bswap );
+    }
+    _mm_storeu_si128( ( __m128i * )remainder, x0 );
+
+    if ( reflected ) {
+        for ( i=0; i<16; i++ ) {
+            crc = ( crc >> 8 ) ^ param->table[0][ ( crc ^ remainder[i] ) & 0xFF ];
+        }
+        while ( len-- ) {
+            crc = ( crc >> 8 ) ^ param->table[0][ ( crc ^ *pSrc++ ) & 0xFF ];
+        }
+    } else {
+        for ( i=0; i<16; i++ ) {
+            crc = ( crc << 8 ) ^ param->table[0][ ( ( crc >> 56 ) ^ remainder[i] ) & 0xFF ];
+        }
+        while ( len-- ) {
+            crc = ( crc << 8 ) ^ param->table[0][ ( ( crc >> 56 ) ^ *pSrc++ ) & 0xFF ];
+        }
+    }
+
+    return crc;
+}
+
+#else
+
+unsigned int hexin_crc64_simd_clmul_support( void )
+{
+    return FALSE;
+}
+
+unsigned long long hexin_crc64_fold_clmul( unsigned long long crc64, const unsigned char *pSrc, unsigned int len,
+                                           const struct _hexin_crc64 *param )
+{
+    return crc64;
+}
+
+#endif /* HEXIN_X86_SIMD */
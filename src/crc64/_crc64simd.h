@@ -0,0 +1,32 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _crc64simd.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize.
+*                      2026-10-17 [Heyn] HEXIN_X86_SIMD and the CPUID helpers come from _modelcpuid.h.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __CRC64_SIMD_H__
+#define __CRC64_SIMD_H__
+
+#include "_crc64tables.h"
+
+#include "_modelcpuid.h"
+
+/* Below this size the slicing-by-8 loop is faster than setting up the folds. */
+#define                 HEXIN_CRC64_FOLD_MINSIZE                64
+
+unsigned int hexin_crc64_simd_clmul_support( void );
+
+unsigned long long hexin_crc64_fold_clmul( unsigned long long crc64, const unsigned char *pSrc, unsigned int len,
+                                           const struct _hexin_crc64 *param );
+
+#endif //__CRC64_SIMD_H__
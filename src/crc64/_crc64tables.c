@@ -10,13 +10,42 @@
 * ---------------
 *		New Create at 	2020-03-13 [Heyn] Initialize
 *                       2020-04-23 [Heyn] New add we() and xz() functions.
+*                       2026-10-17 [Heyn] Split out hexin_crc64_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] New add hacker table cache, least recently used entry is replaced.
+*                       2026-10-17 [Heyn] New add hexin_crc64_update(), the raw register without init / xorout.
+*                       2026-10-17 [Heyn] New add hexin_crc64_zeros(), runs of zero bytes are skipped in O(log n).
+*                       2026-10-17 [Heyn] New add slicing-by-8 compute.
+*                       2026-10-17 [Heyn] New add PCLMULQDQ folding dispatch.
+*                       2026-10-17 [Heyn] New add hexin_crc64_compute_blocks(), one CRC per fixed size block.
+*                       2026-10-17 [Heyn] hexin_crc64_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
+*                       2026-10-17 [Heyn] hexin_crc64_compute_blocks() takes a 64-bit length, only every block is below 4 GB.
 *
 *   SEE : http://reveng.sourceforge.net/crc-catalogue/17plus.htm#crc.cat-bits.64
 *
 *********************************************************************************************************
 */
 
+#include <string.h>
 #include "_crc64tables.h"
+#include "_crc64simd.h"
+
+#if defined( HEXIN_CONST_TABLES )
+#include "_crc64const.h"
+
+static const struct _hexin_crc64_const *hexin_crc64_const_lookup( const struct _hexin_crc64 *param )
+{
+    const struct _hexin_crc64_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_crc64_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
 
 unsigned long long hexin_reverse64( unsigned long long data )
 {
@@ -91,7 +120,7 @@ unsigned long long hexin_crc64_poly_is_low_calc( unsigned long long crc64, unsig
     return crc;
 }
 
-static unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param )
+static unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param, unsigned long long polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned long long crc = 0x0000000000000000L;
@@ -102,12 +131,20 @@ static unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param )
             crc = ( unsigned long long ) i;
             for ( j=0; j<8; j++ ) {
                 if ( crc & 0x0000000000000001L ) {
-                    crc = ( crc >> 1 ) ^ param->poly; 
+                    crc = ( crc >> 1 ) ^ polynomial; 
                 } else { 
                     crc = ( crc >> 1 );
                 }
             }
-            param->table[i] = crc;
+            param->table_buffer[0][i] = crc;
+        }
+        /* table[j][i] = CRC of byte i followed by j zero bytes. */
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = param->table_buffer[0][i];
+            for ( j=1; j<HEXIN_CRC64_SLICE_ARRAY; j++ ) {
+                crc = ( crc >> 8 ) ^ param->table_buffer[0][ crc & 0xFF ];
+                param->table_buffer[j][i] = crc;
+            }
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
@@ -115,51 +152,369 @@ static unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param )
             c	= ( ( unsigned long long ) i ) << 56;
             for ( j=0; j<8; j++ ) {
                 if ( ( crc ^ c ) & 0x8000000000000000L ) {
-                    crc = ( crc << 1 ) ^ param->poly;
+                    crc = ( crc << 1 ) ^ polynomial;
                 } else { 
                     crc = ( crc << 1 );
                 }
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[0][i] = crc;
+        }
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = param->table_buffer[0][i];
+            for ( j=1; j<HEXIN_CRC64_SLICE_ARRAY; j++ ) {
+                crc = ( crc << 8 ) ^ param->table_buffer[0][ crc >> 56 ];
+                param->table_buffer[j][i] = crc;
+            }
         }
     }
+    param->table = ( const unsigned long long (*)[MAX_TABLE_ARRAY] )param->table_buffer;
     return TRUE;
 }
 
-static unsigned long long hexin_crc64_compute_char( unsigned long long crc64, unsigned char c, struct _hexin_crc64 *param )
+/*
+ * x^n mod ( x^64 + polynomial ), polynomial in MSB-first form.
+ */
+static unsigned long long hexin_crc64_xpow_mod( unsigned int n, unsigned long long polynomial )
 {
-    unsigned long long crc = crc64;
+    unsigned long long r = 0x0000000000000001L;
+
+    while ( n-- ) {
+        if ( r & 0x8000000000000000L ) r = ( r << 1 ) ^ polynomial;
+        else                           r = ( r << 1 );
+    }
+    return r;
+}
+
+/*
+ * Fold constants, laid out as in hexin_crc32_compute_init_fold(). A 64-bit constant
+ * fills its lane, the reflected ones are pre-divided by x.
+ */
+static void hexin_crc64_compute_init_fold( struct _hexin_crc64 *param )
+{
+    static const unsigned int distance[HEXIN_CRC64_FOLD_ARRAY/2] = { 512, 384, 256, 128 };
+    unsigned int i = 0;
+    unsigned long long poly = ( param->poly << ( HEXIN_CRC64_WIDTH - param->width ) );
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-        crc = (crc >> 8) ^ param->table[ ((crc >> 0 ) ^ (0x00000000000000FFL & (unsigned long long)c)) & 0xFF ];
+        for ( i=0; i<HEXIN_CRC64_FOLD_ARRAY/2; i++ ) {
+            param->fold_buffer[2*i+0] = hexin_reverse64( hexin_crc64_xpow_mod( distance[i] + 63, poly ) );
+            param->fold_buffer[2*i+1] = hexin_reverse64( hexin_crc64_xpow_mod( distance[i] - 1,  poly ) );
+        }
     } else {
-        crc = (crc << 8) ^ param->table[ ((crc >> 56) ^ (0x00000000000000FFL & (unsigned long long)c)) & 0xFF ];
+        for ( i=0; i<HEXIN_CRC64_FOLD_ARRAY/2; i++ ) {
+            param->fold_buffer[2*i+0] = hexin_crc64_xpow_mod( distance[i],      poly );
+            param->fold_buffer[2*i+1] = hexin_crc64_xpow_mod( distance[i] + 64, poly );
+        }
+    }
+    param->fold = param->fold_buffer;
+}
+
+static unsigned long long hexin_crc64_compute_slice_ref( unsigned long long crc64, const unsigned char *pSrc, unsigned int len,
+                                                         const unsigned long long (*table)[MAX_TABLE_ARRAY] )
+{
+    unsigned long long crc = crc64;
+
+    while ( len >= 8 ) {
+        crc ^= ( ( unsigned long long )pSrc[0]       ) | ( ( unsigned long long )pSrc[1] << 8  )
+             | ( ( unsigned long long )pSrc[2] << 16 ) | ( ( unsigned long long )pSrc[3] << 24 )
+             | ( ( unsigned long long )pSrc[4] << 32 ) | ( ( unsigned long long )pSrc[5] << 40 )
+             | ( ( unsigned long long )pSrc[6] << 48 ) | ( ( unsigned long long )pSrc[7] << 56 );
+        crc  = table[7][ ( crc       ) & 0xFF ] ^ table[6][ ( crc >> 8  ) & 0xFF ]
+             ^ table[5][ ( crc >> 16 ) & 0xFF ] ^ table[4][ ( crc >> 24 ) & 0xFF ]
+             ^ table[3][ ( crc >> 32 ) & 0xFF ] ^ table[2][ ( crc >> 40 ) & 0xFF ]
+             ^ table[1][ ( crc >> 48 ) & 0xFF ] ^ table[0][ ( crc >> 56 )        ];
+        pSrc += 8;
+        len  -= 8;
+    }
+
+    while ( len-- ) {
+        crc = ( crc >> 8 ) ^ table[0][ ( crc ^ *pSrc++ ) & 0xFF ];
+    }
+
+    return crc;
+}
+
+static unsigned long long hexin_crc64_compute_slice( unsigned long long crc64, const unsigned char *pSrc, unsigned int len,
+                                                     const unsigned long long (*table)[MAX_TABLE_ARRAY] )
+{
+    unsigned long long crc = crc64;
+
+    while ( len >= 8 ) {
+        crc ^= ( ( unsigned long long )pSrc[0] << 56 ) | ( ( unsigned long long )pSrc[1] << 48 )
+             | ( ( unsigned long long )pSrc[2] << 40 ) | ( ( unsigned long long )pSrc[3] << 32 )
+             | ( ( unsigned long long )pSrc[4] << 24 ) | ( ( unsigned long long )pSrc[5] << 16 )
+             | ( ( unsigned long long )pSrc[6] << 8  ) | ( ( unsigned long long )pSrc[7]       );
+        crc  = table[7][ ( crc >> 56 )        ] ^ table[6][ ( crc >> 48 ) & 0xFF ]
+             ^ table[5][ ( crc >> 40 ) & 0xFF ] ^ table[4][ ( crc >> 32 ) & 0xFF ]
+             ^ table[3][ ( crc >> 24 ) & 0xFF ] ^ table[2][ ( crc >> 16 ) & 0xFF ]
+             ^ table[1][ ( crc >> 8  ) & 0xFF ] ^ table[0][ ( crc       ) & 0xFF ];
+        pSrc += 8;
+        len  -= 8;
+    }
+
+    while ( len-- ) {
+        crc = ( crc << 8 ) ^ table[0][ ( ( crc >> 56 ) ^ *pSrc++ ) & 0xFF ];
     }
 
     return crc;
 }
 
-unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc64 *param )
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_crc64_compute_init( struct _hexin_crc64 *param )
+{
+    unsigned long long poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_crc64_const *entry = NULL;
+#endif
+
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
+    }
+
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_crc64_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->fold  = entry->fold;
+        param->is_initial = TRUE;
+        return TRUE;
+    }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        poly = ( hexin_reverse64( param->poly ) >> ( HEXIN_CRC64_WIDTH - param->width ) );
+    } else {
+        poly = ( param->poly << ( HEXIN_CRC64_WIDTH - param->width ) );
+    }
+    hexin_crc64_compute_init_fold( param );
+    param->is_initial = hexin_crc64_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+/*
+ * a * b mod ( x^64 + polynomial ), MSB-first. A register aligned to bit 63 is a multiple of
+ * x^(64 - width) and stays one, so this is exact for narrower widths too.
+ */
+static unsigned long long hexin_crc64_multiply( unsigned long long a, unsigned long long b, unsigned long long polynomial )
 {
+    unsigned long long product = 0;
     unsigned int i = 0;
-    unsigned long long result = 0;
-    unsigned long long crc  = ( param->init << ( HEXIN_CRC64_WIDTH - param->width ) );
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = ( hexin_reverse64( param->poly ) >> ( HEXIN_CRC64_WIDTH - param->width ) );
+    for ( i=0; i<64; i++ ) {
+        product = ( product & 0x8000000000000000L ) ? ( ( product << 1 ) ^ polynomial ) : ( product << 1 );
+        if ( a & ( 0x8000000000000000L >> i ) ) {
+            product ^= b;
+        }
+    }
+    return product;
+}
+
+/* Raw register after n zero bytes: multiply by x^(8n), square and multiply. */
+unsigned long long hexin_crc64_zeros( unsigned long long crc64, unsigned long long n, const struct _hexin_crc64 *param )
+{
+    unsigned long long poly = ( param->poly << ( HEXIN_CRC64_WIDTH - param->width ) );
+    unsigned long long crc  = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? hexin_reverse64( crc64 ) : crc64;
+    unsigned long long xpow = 0x0000000000000001L;
+    unsigned long long x8n  = 0x0000000000000100L;
+
+    for ( ; n != 0; n >>= 1 ) {
+        if ( n & 1 ) {
+            xpow = hexin_crc64_multiply( xpow, x8n, poly );
+        }
+        x8n = hexin_crc64_multiply( x8n, x8n, poly );
+    }
+
+    crc = hexin_crc64_multiply( crc, xpow, poly );
+    return HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? hexin_reverse64( crc ) : crc;
+}
+
+/* Number of leading zero bytes, checked 64 bytes at a time. */
+static unsigned int hexin_crc64_zero_run( const unsigned char *pSrc, unsigned int len )
+{
+    unsigned long long w[8];
+    unsigned int n = 0;
+
+    while ( len - n >= sizeof( w ) ) {
+        memcpy( w, pSrc + n, sizeof( w ) );
+        if ( w[0] | w[1] | w[2] | w[3] | w[4] | w[5] | w[6] | w[7] ) {
+            break;
+        }
+        n += sizeof( w );
+    }
+    return n;
+}
+
+static unsigned long long hexin_crc64_update_block( unsigned long long crc64, const unsigned char *pSrc, unsigned int len,
+                                                    const struct _hexin_crc64 *param )
+{
+    if ( ( len >= HEXIN_CRC64_FOLD_MINSIZE ) && hexin_crc64_simd_clmul_support() ) {
+        return hexin_crc64_fold_clmul( crc64, pSrc, len, param );
+    }
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return hexin_crc64_compute_slice_ref( crc64, pSrc, len, param->table );
+    }
+    return hexin_crc64_compute_slice( crc64, pSrc, len, param->table );
+}
+
+/*
+ * Run the raw register over pSrc: MSB-first registers are aligned to bit 63, reflected
+ * ones to bit 0. No init or xorout is applied.
+ * Runs of HEXIN_CRC64_ZERO_MINSIZE zero bytes or more are skipped with hexin_crc64_zeros().
+ */
+unsigned long long hexin_crc64_update( unsigned long long crc64, const unsigned char *pSrc, unsigned int len, const struct _hexin_crc64 *param )
+{
+    unsigned long long crc = crc64;
+    unsigned int size = 0;
+
+    while ( len >= HEXIN_CRC64_ZERO_MINSIZE ) {
+        size = hexin_crc64_zero_run( pSrc, len );
+        if ( size >= HEXIN_CRC64_ZERO_MINSIZE ) {
+            crc = hexin_crc64_zeros( crc, size, param );
         } else {
-            param->poly = ( param->poly << ( HEXIN_CRC64_WIDTH - param->width ) );
+            size = HEXIN_CRC64_ZERO_MINSIZE;
+            crc  = hexin_crc64_update_block( crc, pSrc, size, param );
         }
-        param->is_initial = hexin_crc64_compute_init_table( param );
+        pSrc += size;
+        len  -= size;
     }
 
-	for ( i=0; i<len; i++ ) {
-		crc = hexin_crc64_compute_char( crc, pSrc[i], param );
-	}
+    return hexin_crc64_update_block( crc, pSrc, len, param );
+}
+
+unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc64 *param )
+{
+    unsigned long long result = 0;
+    unsigned long long crc  = ( param->init << ( HEXIN_CRC64_WIDTH - param->width ) );
+
+    while ( len > HEXIN_CRC64_UPDATE_MAXSIZE ) {
+        crc   = hexin_crc64_update( crc, pSrc, HEXIN_CRC64_UPDATE_MAXSIZE, param );
+        pSrc += HEXIN_CRC64_UPDATE_MAXSIZE;
+        len  -= HEXIN_CRC64_UPDATE_MAXSIZE;
+    }
+    crc = hexin_crc64_update( crc, pSrc, ( unsigned int )len, param );
 
     result = ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) ? crc : ( crc >> ( HEXIN_CRC64_WIDTH - param->width ) );
     
 	return ( result ^ param->xorout ); 
 }
+
+/* One CRC per block_size bytes, len is a multiple of block_size. */
+void hexin_crc64_compute_blocks( const unsigned char *pSrc, unsigned long long len, unsigned int block_size,
+                                 const struct _hexin_crc64 *param, unsigned long long *result )
+{
+    unsigned long long i = 0;
+
+    for ( i=0; i<len/block_size; i++ ) {
+        result[i] = hexin_crc64_compute( pSrc + i * block_size, block_size, param );
+    }
+}
+
+/*
+ * Tables built for hacker parameters, keyed by ( width, poly, refin, refout ).
+ * There is no lock, the module only calls in here with the GIL held. An entry in
+ * use by a computation running without the GIL is never replaced.
+ */
+static struct _hexin_crc64_cache {
+    unsigned int        valid;
+    unsigned int        refs;
+    unsigned long long  used;
+    struct _hexin_crc64  param;
+} hexin_crc64_cache[HEXIN_CRC64_CACHE_SIZE];
+
+static unsigned long long hexin_crc64_cache_tick   = 0;
+static unsigned long long hexin_crc64_cache_hits   = 0;
+static unsigned long long hexin_crc64_cache_misses = 0;
+
+/*
+ * Point param at a cached table, building it on a miss. Returns the handle to pass to
+ * hexin_crc64_cache_release(), or 0 when every entry is in use and param got its own table.
+ */
+unsigned int hexin_crc64_cache_acquire( struct _hexin_crc64 *param )
+{
+    struct _hexin_crc64_cache *slot  = NULL;
+    struct _hexin_crc64_cache *entry = NULL;
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC64_CACHE_SIZE; i++ ) {
+        entry = &hexin_crc64_cache[i];
+        if ( entry->valid && ( entry->param.width == param->width ) && ( entry->param.poly   == param->poly  )
+                          && ( entry->param.refin == param->refin ) && ( entry->param.refout == param->refout ) ) {
+            slot = entry;
+            break;
+        }
+    }
+
+    if ( slot != NULL ) {
+        hexin_crc64_cache_hits++;
+    } else {
+        hexin_crc64_cache_misses++;
+        for ( i=0; i<HEXIN_CRC64_CACHE_SIZE; i++ ) {
+            entry = &hexin_crc64_cache[i];
+            if ( entry->refs != 0 ) {
+                continue;
+            }
+            if ( !entry->valid ) {
+                slot = entry;
+                break;
+            }
+            if ( ( slot == NULL ) || ( entry->used < slot->used ) ) {
+                slot = entry;
+            }
+        }
+
+        if ( slot == NULL ) {
+            hexin_crc64_compute_init( param );
+            return 0;
+        }
+
+        slot->valid             = FALSE;
+        slot->param.is_initial  = FALSE;
+        slot->param.width       = param->width;
+        slot->param.poly        = param->poly;
+        slot->param.refin       = param->refin;
+        slot->param.refout      = param->refout;
+        slot->valid = hexin_crc64_compute_init( &slot->param );
+    }
+
+    slot->used = ++hexin_crc64_cache_tick;
+    slot->refs++;
+    param->table = slot->param.table;
+    param->fold  = slot->param.fold;
+    param->is_initial = TRUE;
+    return ( unsigned int )( slot - hexin_crc64_cache ) + 1;
+}
+
+void hexin_crc64_cache_release( unsigned int handle )
+{
+    if ( ( handle > 0 ) && ( handle <= HEXIN_CRC64_CACHE_SIZE ) && ( hexin_crc64_cache[handle - 1].refs > 0 ) ) {
+        hexin_crc64_cache[handle - 1].refs--;
+    }
+}
+
+void hexin_crc64_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count )
+{
+    unsigned int i = 0;
+
+    *hits   = hexin_crc64_cache_hits;
+    *misses = hexin_crc64_cache_misses;
+    *count  = 0;
+    for ( i=0; i<HEXIN_CRC64_CACHE_SIZE; i++ ) {
+        *count += hexin_crc64_cache[i].valid ? 1 : 0;
+    }
+}
+
+/* Drops every entry not in use and resets the counters. */
+void hexin_crc64_cache_clear( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC64_CACHE_SIZE; i++ ) {
+        if ( hexin_crc64_cache[i].refs == 0 ) {
+            hexin_crc64_cache[i].valid = FALSE;
+        }
+    }
+    hexin_crc64_cache_hits   = 0;
+    hexin_crc64_cache_misses = 0;
+}
@@ -10,6 +10,14 @@
 * ---------------
 *		New Create at 	2020-03-13 [Heyn] Initialize.
 *                       2020-04-23 [Heyn] New add we() and xz() functions.
+*                       2026-10-17 [Heyn] New add hexin_crc64_compute_init().
+*                       2026-10-17 [Heyn] Catalogue tables come from the generated _crc64const.h.
+*                       2026-10-17 [Heyn] New add hacker table cache.
+*                       2026-10-17 [Heyn] New add hexin_crc64_update().
+*                       2026-10-17 [Heyn] New add hexin_crc64_zeros() and HEXIN_CRC64_ZERO_MINSIZE.
+*                       2026-10-17 [Heyn] New add slicing-by-8 tables, table[j][i] = CRC of byte i followed by j zero bytes.
+*                       2026-10-17 [Heyn] New add PCLMULQDQ fold constants.
+*                       2026-10-17 [Heyn] New add CRC-64/NVME polynomial and hexin_crc64_compute_blocks().
 *
 *********************************************************************************************************
 */
@@ -31,11 +39,31 @@
 
 #define                 HEXIN_CRC64_WIDTH                       64
 
+/* Number of hacker parameter tables kept by hexin_crc64_cache_acquire(). */
+#ifndef HEXIN_CRC64_CACHE_SIZE
+#define                 HEXIN_CRC64_CACHE_SIZE                  16
+#endif
+
+#ifndef HEXIN_CRC64_SLICE_ARRAY
+#define                 HEXIN_CRC64_SLICE_ARRAY                 8
+#endif
+
+#define                 HEXIN_CRC64_FOLD_ARRAY                  8
+
+/* hexin_crc64_compute() feeds hexin_crc64_update() at most this many bytes at a time. */
+#define                 HEXIN_CRC64_UPDATE_MAXSIZE              0x40000000
+
+/* Runs of at least this many zero bytes are skipped rather than computed. */
+#ifndef HEXIN_CRC64_ZERO_MINSIZE
+#define                 HEXIN_CRC64_ZERO_MINSIZE                0x10000
+#endif
+
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x8000000000000000L )
 #define                 HEXIN_REFIN_OR_REFOUT_IS_TRUE(x)        ( x == 0x0000000000000001L ? TRUE : FALSE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 
 #define		            CRC64_POLYNOMIAL_ECMA182                0x42F0E1EBA9EA3693L
+#define                 CRC64_POLYNOMIAL_NVME                   0xAD93D23594C93659L
 
 
 struct _hexin_crc64 {
@@ -47,7 +75,19 @@ struct _hexin_crc64 {
     unsigned int  refout;
     unsigned long long  xorout;
     unsigned long long  result;
-    unsigned long long  table[MAX_TABLE_ARRAY];
+    const unsigned long long  (*table)[MAX_TABLE_ARRAY];
+    const unsigned long long  *fold;
+    unsigned long long  table_buffer[HEXIN_CRC64_SLICE_ARRAY][MAX_TABLE_ARRAY];
+    unsigned long long  fold_buffer[HEXIN_CRC64_FOLD_ARRAY];
+};
+
+/* One entry of the generated _crc64const.h ( see src/gentables.py ). */
+struct _hexin_crc64_const {
+    unsigned int  width;
+    unsigned long long  poly;
+    unsigned int  reflected;
+    const unsigned long long  (*table)[MAX_TABLE_ARRAY];
+    const unsigned long long  *fold;
 };
 
 
@@ -56,6 +96,16 @@ unsigned long long hexin_reverse64( unsigned long long data );
 unsigned char hexin_crc64_init_table_poly_is_high( unsigned long long polynomial, unsigned long long *table );
 unsigned char hexin_crc64_init_table_poly_is_low(  unsigned long long polynomial, unsigned long long *table );
 
-unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc64 *param );
+unsigned int       hexin_crc64_compute_init( struct _hexin_crc64 *param );
+unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc64 *param );
+unsigned long long hexin_crc64_update( unsigned long long crc64, const unsigned char *pSrc, unsigned int len, const struct _hexin_crc64 *param );
+void hexin_crc64_compute_blocks( const unsigned char *pSrc, unsigned long long len, unsigned int block_size,
+                                 const struct _hexin_crc64 *param, unsigned long long *result );
+unsigned long long hexin_crc64_zeros( unsigned long long crc64, unsigned long long n, const struct _hexin_crc64 *param );
+
+unsigned int hexin_crc64_cache_acquire( struct _hexin_crc64 *param );
+void hexin_crc64_cache_release( unsigned int handle );
+void hexin_crc64_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count );
+void hexin_crc64_cache_clear( void );
 
 #endif //__CRC64_TABLES_H__
@@ -23,39 +23,55 @@
 *                       2020-02-17 [Heyn] New CRC8-SUM.
 *                       2020-03-20 [Heyn] New CRC8-FLETCHER8.
 *                       2020-04-17 [Heyn] Issues #1
+*                       2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+*                       2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+*                       2026-10-17 [Heyn] hacker8 tables come from an LRU cache, New add _cache_info() / _cache_clear().
+*                       2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+*                       2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+*                       2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+*                       2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
+*                       2026-10-17 [Heyn] Fix intel / bcc / lrc / sum8 / fletcher8 over 4 GB, the helper passes the whole 64-bit length.
 *
 *********************************************************************************************************
 */
 
 #include <Python.h>
 #include "_crc8tables.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
 
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+static unsigned char hexin_PyArg_ParseTuple( HEXIN_FASTCALL_PARAMS,
                                              unsigned char init,
                                              unsigned char (*function)( const unsigned char *,
-                                                                        unsigned int,
+                                                                        unsigned long long,
                                                                         unsigned char ),
                                              unsigned char *result )
 {
     Py_buffer data = { NULL, NULL };
+    PyObject *slots[2];
+    unsigned long long value = init;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "", "", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 2, slots ) || !hexin_PyArg_Mask( slots[1], &value )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned char )value;
 
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (unsigned long long)data.len, init );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = (* function)( (const unsigned char *)data.buf, (unsigned long long)data.len, init );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -63,27 +79,43 @@ static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
     return TRUE;
 }
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc8 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_crc8 *param, unsigned char *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned char )value;
+        } else {
+            *result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -91,124 +123,132 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc8_intel( PyObject *self, PyObject *args )
+static PyObject * _crc8_intel( HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_bcc( PyObject *self, PyObject *args )
+static PyObject * _crc8_bcc( HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_bcc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_bcc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_lrc( PyObject *self, PyObject *args )
+static PyObject * _crc8_lrc( HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_maxim( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_maxim = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_31,
+                                               .init   = 0x00,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x00,
+                                               .result = 0 };
+
+static PyObject * _crc8_maxim( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_maxim = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_31,
-                                                   .init   = 0x00,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_maxim ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_maxim, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_maxim.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_rohc( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_rohc = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_07,
+                                              .init   = 0xFF,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc8_rohc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_rohc = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0xFF,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_rohc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_rohc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_itu( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_itu8 = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_07,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x55,
+                                              .result = 0 };
+
+static PyObject * _crc8_itu( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_itu8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x55,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_itu8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_itu8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_itu8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_crc8( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_crc8 = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_07,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc8_crc8( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_crc8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_crc8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_crc8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_crc8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_sum( PyObject *self, PyObject *args )
+static PyObject * _crc8_sum( HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_sum, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_sum, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc8_table( PyObject *self, PyObject *args )
@@ -234,15 +274,16 @@ static PyObject * _crc8_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "B", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc8_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static PyObject * _crc8_hacker( HEXIN_FASTCALL_PARAMS )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int cache = 0;
     struct _hexin_crc8 crc8_param_hacker = { .is_initial=FALSE,
                                              .width  = HEXIN_CRC8_WIDTH,
                                              .poly   = CRC8_POLYNOMIAL_31,
@@ -251,343 +292,473 @@ static PyObject * _crc8_hacker( PyObject *self, PyObject *args, PyObject* kws )
                                              .refout = FALSE,
                                              .xorout = 0x00,
                                              .result = 0 };
+    unsigned long long poly   = crc8_param_hacker.poly;
+    unsigned long long init   = crc8_param_hacker.init;
+    unsigned long long xorout = crc8_param_hacker.xorout;
+    PyObject *slots[6];
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
+    static const char *const kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", NULL };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|BBBpp", kwlist, &data,
-                                                                      &crc8_param_hacker.poly,
-                                                                      &crc8_param_hacker.init,
-                                                                      &crc8_param_hacker.xorout,
-                                                                      &crc8_param_hacker.refin,
-                                                                      &crc8_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 6, slots )
+      || !hexin_PyArg_Mask( slots[1], &poly ) || !hexin_PyArg_Mask( slots[2], &init ) || !hexin_PyArg_Mask( slots[3], &xorout )
+      || !hexin_PyArg_Bool( slots[4], &crc8_param_hacker.refin ) || !hexin_PyArg_Bool( slots[5], &crc8_param_hacker.refout )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|BBBpp", kwlist, &data,
-                                                                      &crc8_param_hacker.poly,
-                                                                      &crc8_param_hacker.init,
-                                                                      &crc8_param_hacker.xorout,
-                                                                      &crc8_param_hacker.refin,
-                                                                      &crc8_param_hacker.refout ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;
+    crc8_param_hacker.poly   = ( unsigned char )poly;
+    crc8_param_hacker.init   = ( unsigned char )init;
+    crc8_param_hacker.xorout = ( unsigned char )xorout;
+
+    cache = hexin_crc8_cache_acquire( &crc8_param_hacker );
+
+    if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        crc8_param_hacker.result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc8_param_hacker );
+        Py_END_ALLOW_THREADS
+    } else {
+        crc8_param_hacker.result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, &crc8_param_hacker );
     }
-#endif /* PY_MAJOR_VERSION */
 
-    crc8_param_hacker.result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc8_param_hacker );
+    hexin_crc8_cache_release( cache );
 
     if ( data.obj )
        PyBuffer_Release( &data );
 
-    return Py_BuildValue( "B", crc8_param_hacker.result );
+    return PyLong_FromUnsignedLong( crc8_param_hacker.result );
 }
 
-static PyObject * _crc8_fletcher( PyObject *self, PyObject *args )
+static PyObject * _crc8_fletcher( HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result   = 0x00;
     unsigned char reserved = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc8_fletcher, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc8_fletcher, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_autosar8( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_autosar8 = { .is_initial=FALSE,
+                                                  .width  = HEXIN_CRC8_WIDTH,
+                                                  .poly   = CRC8_POLYNOMIAL_2F,
+                                                  .init   = 0xFF,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0xFF,
+                                                  .result = 0 };
+
+static PyObject * _crc8_autosar8( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_autosar8 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC8_WIDTH,
-                                                      .poly   = CRC8_POLYNOMIAL_2F,
-                                                      .init   = 0xFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0xFF,
-                                                      .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_autosar8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_autosar8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_autosar8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_lte8( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_lte8 = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_9B,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc8_lte8( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_lte8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_9B,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_lte8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_lte8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_lte8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_wcdma( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_wcdma = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_9B,
+                                               .init   = 0x00,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x00,
+                                               .result = 0 };
+
+static PyObject * _crc8_wcdma( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_wcdma = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_9B,
-                                                   .init   = 0x00,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_wcdma ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_wcdma, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_wcdma.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_sae_j1850( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_j1850 = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_1D,
+                                               .init   = 0xFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0xFF,
+                                               .result = 0 };
+
+static PyObject * _crc8_sae_j1850( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_j1850 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0xFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFF,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_j1850 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_j1850, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_j1850.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_icode( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_icode = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_1D,
+                                               .init   = 0xFD,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .result = 0 };
+
+static PyObject * _crc8_icode( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_icode = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0xFD,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_icode ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_icode, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_icode.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_gsm8_a( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_gsm8a = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_1D,
+                                               .init   = 0x00,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .result = 0 };
+
+static PyObject * _crc8_gsm8_a( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_gsm8a = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_gsm8a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_gsm8a, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_gsm8a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_gsm8_b( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_gsm8b = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_49,
+                                               .init   = 0x00,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0xFF,
+                                               .result = 0 };
+
+static PyObject * _crc8_gsm8_b( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_gsm8b = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_49,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFF,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_gsm8b ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_gsm8b, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_gsm8b.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_nrsc_5( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_nrsc5 = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_31,
+                                               .init   = 0xFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .result = 0 };
+
+static PyObject * _crc8_nrsc_5( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_nrsc5 = { .is_initial=FALSE,
+    unsigned char result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_nrsc5, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crc8 crc8_param_bluetooth = { .is_initial=FALSE,
                                                    .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_31,
-                                                   .init   = 0xFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
+                                                   .poly   = CRC8_POLYNOMIAL_A7,
+                                                   .init   = 0x00,
+                                                   .refin  = TRUE,
+                                                   .refout = TRUE,
                                                    .xorout = 0x00,
                                                    .result = 0 };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_nrsc5 ) ) {
+static PyObject * _crc8_bluetooth( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned char result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_bluetooth, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_nrsc5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_bluetooth( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_dvbs2 = { .is_initial=FALSE,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_D5,
+                                               .init   = 0x00,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .result = 0 };
+
+static PyObject * _crc8_dvb_s2( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_bluetooth = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC8_WIDTH,
-                                                       .poly   = CRC8_POLYNOMIAL_A7,
-                                                       .init   = 0x00,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0x00,
-                                                       .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_bluetooth ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_dvbs2, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_bluetooth.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_dvb_s2( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_ebu8 = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_1D,
+                                              .init   = 0xFF,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc8_ebu8( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_dvbs2 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_D5,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_dvbs2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_ebu8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_dvbs2.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_ebu8( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_darc = { .is_initial=FALSE,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_39,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc8_darc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_ebu8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_1D,
-                                                  .init   = 0xFF,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_ebu8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_darc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_ebu8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_darc( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_opensafety8 = { .is_initial=FALSE,
+                                                     .width  = HEXIN_CRC8_WIDTH,
+                                                     .poly   = CRC8_POLYNOMIAL_2F,
+                                                     .init   = 0x00,
+                                                     .refin  = FALSE,
+                                                     .refout = FALSE,
+                                                     .xorout = 0x00,
+                                                     .result = 0 };
+
+static PyObject * _crc8_opensafety8( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_darc = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_39,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_opensafety8, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_darc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_opensafety8( PyObject *self, PyObject *args )
+static struct _hexin_crc8 crc8_param_mifare_mad = { .is_initial=FALSE,
+                                                    .width  = HEXIN_CRC8_WIDTH,
+                                                    .poly   = CRC8_POLYNOMIAL_1D,
+                                                    .init   = 0xC7,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x00,
+                                                    .result = 0 };
+
+static PyObject * _crc8_mifare_mad( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_opensafety8 = { .is_initial=FALSE,
-                                                         .width  = HEXIN_CRC8_WIDTH,
-                                                         .poly   = CRC8_POLYNOMIAL_2F,
-                                                         .init   = 0x00,
-                                                         .refin  = FALSE,
-                                                         .refout = FALSE,
-                                                         .xorout = 0x00,
-                                                         .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_opensafety8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc8_param_mifare_mad, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_opensafety8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_mifare_mad( PyObject *self, PyObject *args )
+static PyObject * _crc8_gil_threshold( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc8 crc8_param_mifare_mad = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC8_WIDTH,
-                                                        .poly   = CRC8_POLYNOMIAL_1D,
-                                                        .init   = 0xC7,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00,
-                                                        .result = 0 };
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_mifare_mad ) ) {
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_mifare_mad.result );
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+static PyObject * _crc8_cache_info( PyObject *self, PyObject *args )
+{
+    unsigned long long hits = 0, misses = 0;
+    unsigned int count = 0;
+
+    hexin_crc8_cache_info( &hits, &misses, &count );
+    return Py_BuildValue( "KKII", hits, misses, ( unsigned int )HEXIN_CRC8_CACHE_SIZE, count );
+}
+
+static PyObject * _crc8_cache_clear( PyObject *self, PyObject *args )
+{
+    hexin_crc8_cache_clear();
+    Py_RETURN_NONE;
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_crc8_catalogue {
+    const char          *name;
+    struct _hexin_crc8  *param;
+} hexin_crc8_params[] = {
+    { "maxim8",      &crc8_param_maxim },
+    { "rohc",        &crc8_param_rohc },
+    { "itu8",        &crc8_param_itu8 },
+    { "i432_1",      &crc8_param_itu8 },
+    { "crc8",        &crc8_param_crc8 },
+    { "smbus",       &crc8_param_crc8 },
+    { "autosar8",    &crc8_param_autosar8 },
+    { "lte8",        &crc8_param_lte8 },
+    { "sae_j1850",   &crc8_param_j1850 },
+    { "icode8",      &crc8_param_icode },
+    { "gsm8_a",      &crc8_param_gsm8a },
+    { "gsm8_b",      &crc8_param_gsm8b },
+    { "nrsc_5",      &crc8_param_nrsc5 },
+    { "wcdma8",      &crc8_param_wcdma },
+    { "bluetooth",   &crc8_param_bluetooth },
+    { "dvb_s2",      &crc8_param_dvbs2 },
+    { "ebu8",        &crc8_param_ebu8 },
+    { "tech_3250",   &crc8_param_ebu8 },
+    { "aes8",        &crc8_param_ebu8 },
+    { "darc8",       &crc8_param_darc },
+    { "opensafety8", &crc8_param_opensafety8 },
+    { "mifare_mad",  &crc8_param_mifare_mad },
+    { NULL, NULL }
+};
+
+static void hexin_crc8_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_crc8_params[i].name != NULL; i++ ) {
+        hexin_crc8_compute_init( hexin_crc8_params[i].param );
+    }
+}
+
+static PyObject * _crc8_catalogue( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( pdict == NULL ) {
+        return NULL;
+    }
+
+    for ( i=0; hexin_crc8_params[i].name != NULL; i++ ) {
+        param = hexin_crc8_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_crc8_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
 }
 
 /* method table */
 static PyMethodDef _crc8Methods[] = {
-    { "intel",      (PyCFunction)_crc8_intel,        METH_VARARGS, "Calculate Intel hexadecimal of CRC8 [Initial=0x00]" },
-    { "bcc",        (PyCFunction)_crc8_bcc,          METH_VARARGS, "Calculate BCC of CRC8 [Initial=0x00]" },
-    { "lrc",        (PyCFunction)_crc8_lrc,          METH_VARARGS, "Calculate LRC of CRC8 [Initial=0x00]" },
-    { "maxim8",     (PyCFunction)_crc8_maxim,        METH_VARARGS, "Calculate MAXIM(MAXIM-DOM) of CRC8 [Poly=0x31 Initial=0x00 Xorout=0x00 Refin=True Refout=True] e.g. DS18B20" },
-    { "rohc",       (PyCFunction)_crc8_rohc,         METH_VARARGS, "Calculate ROHC of CRC8 [Poly=0x07 Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "itu8",       (PyCFunction)_crc8_itu,          METH_VARARGS, "Calculate ITU of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
-    { "i432_1",     (PyCFunction)_crc8_itu,          METH_VARARGS, "Calculate I-432-1 of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
-    { "crc8",       (PyCFunction)_crc8_crc8,         METH_VARARGS, "Calculate CRC of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "sum8",       (PyCFunction)_crc8_sum,          METH_VARARGS, "Calculate SUM of CRC8 [Initial=0x00]" },
+    { "intel",      (PyCFunction)_crc8_intel,        HEXIN_METH_FASTCALL, "Calculate Intel hexadecimal of CRC8 [Initial=0x00]" },
+    { "bcc",        (PyCFunction)_crc8_bcc,          HEXIN_METH_FASTCALL, "Calculate BCC of CRC8 [Initial=0x00]" },
+    { "lrc",        (PyCFunction)_crc8_lrc,          HEXIN_METH_FASTCALL, "Calculate LRC of CRC8 [Initial=0x00]" },
+    { "maxim8",     (PyCFunction)_crc8_maxim,        HEXIN_METH_FASTCALL, "Calculate MAXIM(MAXIM-DOM) of CRC8 [Poly=0x31 Initial=0x00 Xorout=0x00 Refin=True Refout=True] e.g. DS18B20" },
+    { "rohc",       (PyCFunction)_crc8_rohc,         HEXIN_METH_FASTCALL, "Calculate ROHC of CRC8 [Poly=0x07 Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "itu8",       (PyCFunction)_crc8_itu,          HEXIN_METH_FASTCALL, "Calculate ITU of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
+    { "i432_1",     (PyCFunction)_crc8_itu,          HEXIN_METH_FASTCALL, "Calculate I-432-1 of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
+    { "crc8",       (PyCFunction)_crc8_crc8,         HEXIN_METH_FASTCALL, "Calculate CRC of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "sum8",       (PyCFunction)_crc8_sum,          HEXIN_METH_FASTCALL, "Calculate SUM of CRC8 [Initial=0x00]" },
     { "table8",     (PyCFunction)_crc8_table,        METH_VARARGS, "Print CRC8 table to list. libscrc.table8( polynomial )" },
-    { "hacker8",    (PyCFunction)_crc8_hacker,       METH_KEYWORDS|METH_VARARGS, "User calculation CRC8\n"
+    { "hacker8",    (PyCFunction)_crc8_hacker,       HEXIN_METH_FASTCALL, "User calculation CRC8\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x31\n"
                                                                                  "@init   : default=0xFF\n"
                                                                                  "@xorout : default=0x00\n"
                                                                                  "@ref    : default=False" },
-    { "fletcher8",  (PyCFunction)_crc8_fletcher,     METH_VARARGS, "Calculate fletcher8" },
-    { "smbus",      (PyCFunction)_crc8_crc8,         METH_VARARGS, "Calculate SMBUS of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "autosar8",   (PyCFunction)_crc8_autosar8,     METH_VARARGS, "Calculate AUTOSAR of CRC8 [Poly=0x2F Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
-    { "lte8",       (PyCFunction)_crc8_lte8,         METH_VARARGS, "Calculate LTE of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "sae_j1850",  (PyCFunction)_crc8_sae_j1850,    METH_VARARGS, "Calculate SAE-J1850 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
-    { "icode8",     (PyCFunction)_crc8_icode,        METH_VARARGS, "Calculate I-CODE of CRC8 [Poly=0x1D Initial=0xFD Xorout=0x00 Refin=False Refout=False]" },
-    { "gsm8_a",     (PyCFunction)_crc8_gsm8_a,       METH_VARARGS, "Calculate GSM8-A of CRC8 [Poly=0x1D Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "gsm8_b",     (PyCFunction)_crc8_gsm8_b,       METH_VARARGS, "Calculate GSM8-B of CRC8 [Poly=0x49 Initial=0x00 Xorout=0xFF Refin=False Refout=False]" },
-    { "nrsc_5",     (PyCFunction)_crc8_nrsc_5,       METH_VARARGS, "Calculate NRSC-5 of CRC8 [Poly=0x31 Initial=0xFF Xorout=0x00 Refin=False Refout=False]" },
-    { "wcdma8",     (PyCFunction)_crc8_wcdma,        METH_VARARGS, "Calculate WCDMA of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "bluetooth",  (PyCFunction)_crc8_bluetooth,    METH_VARARGS, "Calculate BLUETOOTH of CRC8 [Poly=0xA7 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "dvb_s2",     (PyCFunction)_crc8_dvb_s2,       METH_VARARGS, "Calculate DVB-S2 of CRC8 [Poly=0xD5 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "ebu8",       (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate EBU of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "tech_3250",  (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate TECH-3250 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "aes8",       (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate AES of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "darc8",      (PyCFunction)_crc8_darc,         METH_VARARGS, "Calculate DARC of CRC8 [Poly=0x39 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "opensafety8",(PyCFunction)_crc8_opensafety8,  METH_VARARGS, "Calculate OPENSAFETY of CRC8 [Poly=0x2F Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "mifare_mad", (PyCFunction)_crc8_mifare_mad,   METH_VARARGS, "Calculate MIFARE-MAD of CRC8 [Poly=0x1D Initial=0xC7 Xorout=0x00 Refin=False Refout=False]" },
+    { "fletcher8",  (PyCFunction)_crc8_fletcher,     HEXIN_METH_FASTCALL, "Calculate fletcher8" },
+    { "smbus",      (PyCFunction)_crc8_crc8,         HEXIN_METH_FASTCALL, "Calculate SMBUS of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "autosar8",   (PyCFunction)_crc8_autosar8,     HEXIN_METH_FASTCALL, "Calculate AUTOSAR of CRC8 [Poly=0x2F Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
+    { "lte8",       (PyCFunction)_crc8_lte8,         HEXIN_METH_FASTCALL, "Calculate LTE of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "sae_j1850",  (PyCFunction)_crc8_sae_j1850,    HEXIN_METH_FASTCALL, "Calculate SAE-J1850 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
+    { "icode8",     (PyCFunction)_crc8_icode,        HEXIN_METH_FASTCALL, "Calculate I-CODE of CRC8 [Poly=0x1D Initial=0xFD Xorout=0x00 Refin=False Refout=False]" },
+    { "gsm8_a",     (PyCFunction)_crc8_gsm8_a,       HEXIN_METH_FASTCALL, "Calculate GSM8-A of CRC8 [Poly=0x1D Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "gsm8_b",     (PyCFunction)_crc8_gsm8_b,       HEXIN_METH_FASTCALL, "Calculate GSM8-B of CRC8 [Poly=0x49 Initial=0x00 Xorout=0xFF Refin=False Refout=False]" },
+    { "nrsc_5",     (PyCFunction)_crc8_nrsc_5,       HEXIN_METH_FASTCALL, "Calculate NRSC-5 of CRC8 [Poly=0x31 Initial=0xFF Xorout=0x00 Refin=False Refout=False]" },
+    { "wcdma8",     (PyCFunction)_crc8_wcdma,        HEXIN_METH_FASTCALL, "Calculate WCDMA of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "bluetooth",  (PyCFunction)_crc8_bluetooth,    HEXIN_METH_FASTCALL, "Calculate BLUETOOTH of CRC8 [Poly=0xA7 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "dvb_s2",     (PyCFunction)_crc8_dvb_s2,       HEXIN_METH_FASTCALL, "Calculate DVB-S2 of CRC8 [Poly=0xD5 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "ebu8",       (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL, "Calculate EBU of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "tech_3250",  (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL, "Calculate TECH-3250 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "aes8",       (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL, "Calculate AES of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "darc8",      (PyCFunction)_crc8_darc,         HEXIN_METH_FASTCALL, "Calculate DARC of CRC8 [Poly=0x39 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "opensafety8",(PyCFunction)_crc8_opensafety8,  HEXIN_METH_FASTCALL, "Calculate OPENSAFETY of CRC8 [Poly=0x2F Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "mifare_mad", (PyCFunction)_crc8_mifare_mad,   HEXIN_METH_FASTCALL, "Calculate MIFARE-MAD of CRC8 [Poly=0x1D Initial=0xC7 Xorout=0x00 Refin=False Refout=False]" },
+    { "_gil_threshold", (PyCFunction)_crc8_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_crc8_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
+    { "_cache_info",  (PyCFunction)_crc8_cache_info,  METH_NOARGS, "hacker8 table cache (hits, misses, maxsize, currsize)" },
+    { "_cache_clear", (PyCFunction)_crc8_cache_clear, METH_NOARGS, "Empty the hacker8 table cache and reset its counters" },
     
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
@@ -643,6 +814,8 @@ PyInit__crc8( void )
 {
     PyObject *m = NULL;
 
+    hexin_crc8_params_init();
+
     m = PyModule_Create( &_crc8module );
     if ( m == NULL ) {
         return NULL;
@@ -660,6 +833,7 @@ PyInit__crc8( void )
 PyMODINIT_FUNC
 init_crc8( void )
 {
+    hexin_crc8_params_init();
     (void) Py_InitModule3( "_crc8", _crc8Methods, _crc8_doc );
 }
 
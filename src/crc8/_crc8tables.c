@@ -10,6 +10,11 @@
 * ---------------
 *		New Create at 	2020-03-17 [Heyn] Initialize
 *                       2020-03-20 [Heyn] New add hexin_calc_crc8_fletcher
+*                       2026-10-17 [Heyn] Split out hexin_crc8_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] New add hacker table cache, least recently used entry is replaced.
+*                       2026-10-17 [Heyn] hexin_crc8_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
+*                       2026-10-17 [Heyn] Fix bcc / lrc / sum / fletcher over 4 GB, 64-bit length and index.
 *
 *   SEE : http://reveng.sourceforge.net/crc-catalogue/1-15.htm#crc.cat-bits.8
 *
@@ -18,6 +23,23 @@
 
 #include "_crc8tables.h"
 
+#if defined( HEXIN_CONST_TABLES )
+#include "_crc8const.h"
+
+static const struct _hexin_crc8_const *hexin_crc8_const_lookup( const struct _hexin_crc8 *param )
+{
+    const struct _hexin_crc8_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_crc8_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
+
 unsigned char hexin_reverse8( unsigned char data )
 {
     unsigned int  i = 0;
@@ -69,9 +91,9 @@ unsigned char hexin_crc8_poly_calc( unsigned char crc8, unsigned char c, const u
     return table[ crc8 ^ c ];
 }
 
-unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned long long len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    unsigned long long i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -81,9 +103,9 @@ unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned long long len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    unsigned long long i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -94,9 +116,9 @@ unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned long long len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    unsigned long long i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -105,9 +127,9 @@ unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int len, unsigned char crc8 /*reserved*/ )
+unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned long long len, unsigned char crc8 /*reserved*/ )
 {
-    unsigned int i = 0;
+    unsigned long long i = 0;
     unsigned char sum1 = 0, sum2 = 0;
 
     for ( i = 0; i < len; i++ ) {
@@ -117,7 +139,7 @@ unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int
     return ( sum1 & 0xF ) | ( sum2 << 4 );    
 }
 
-static unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param )
+static unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param, unsigned char polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned char crc = 0, c = 0;
@@ -127,43 +149,65 @@ static unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param )
             crc = 0;
             c   = i;
             for ( j=0; j<8; j++ ) {
-                if ( (crc ^ c) & 0x01 )   crc = ( crc >> 1 ) ^ param->poly;
+                if ( (crc ^ c) & 0x01 )   crc = ( crc >> 1 ) ^ polynomial;
                 else                      crc =   crc >> 1;
                 c = c >> 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c   = i;
             for ( j=0; j<8; j++ ) {
-                if ( (crc ^ c) & 0x80 ) crc = ( crc << 1 ) ^ param->poly;
+                if ( (crc ^ c) & 0x80 ) crc = ( crc << 1 ) ^ polynomial;
                 else                    crc =   crc << 1;
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     }
+    param->table = param->table_buffer;
     return TRUE;
 }
 
-static unsigned char hexin_crc8_compute_char( unsigned char crc8, unsigned char c, struct _hexin_crc8 *param )
+static unsigned char hexin_crc8_compute_char( unsigned char crc8, unsigned char c, const struct _hexin_crc8 *param )
 {
     return param->table[ crc8 ^ c ];
 }
 
-unsigned char hexin_crc8_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc8 *param )
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_crc8_compute_init( struct _hexin_crc8 *param )
 {
-    unsigned int i = 0;
-    unsigned char crc = param->init;
+    unsigned char poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_crc8_const *entry = NULL;
+#endif
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = hexin_reverse8( param->poly );
-        }
-        param->is_initial = hexin_crc8_compute_init_table( param );
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
+    }
+
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_crc8_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->is_initial = TRUE;
+        return TRUE;
     }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        poly = hexin_reverse8( param->poly );
+    }
+    param->is_initial = hexin_crc8_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+unsigned char hexin_crc8_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc8 *param )
+{
+    unsigned long long i = 0;
+    unsigned char crc = param->init;
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) { 
         crc = hexin_reverse8( param->init );
@@ -175,3 +219,110 @@ unsigned char hexin_crc8_compute( const unsigned char *pSrc, unsigned int len, s
     
 	return ( crc ^ param->xorout );
 }
+
+/*
+ * Tables built for hacker parameters, keyed by ( width, poly, refin, refout ).
+ * There is no lock, the module only calls in here with the GIL held. An entry in
+ * use by a computation running without the GIL is never replaced.
+ */
+static struct _hexin_crc8_cache {
+    unsigned int        valid;
+    unsigned int        refs;
+    unsigned long long  used;
+    struct _hexin_crc8  param;
+} hexin_crc8_cache[HEXIN_CRC8_CACHE_SIZE];
+
+static unsigned long long hexin_crc8_cache_tick   = 0;
+static unsigned long long hexin_crc8_cache_hits   = 0;
+static unsigned long long hexin_crc8_cache_misses = 0;
+
+/*
+ * Point param at a cached table, building it on a miss. Returns the handle to pass to
+ * hexin_crc8_cache_release(), or 0 when every entry is in use and param got its own table.
+ */
+unsigned int hexin_crc8_cache_acquire( struct _hexin_crc8 *param )
+{
+    struct _hexin_crc8_cache *slot  = NULL;
+    struct _hexin_crc8_cache *entry = NULL;
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC8_CACHE_SIZE; i++ ) {
+        entry = &hexin_crc8_cache[i];
+        if ( entry->valid && ( entry->param.width == param->width ) && ( entry->param.poly   == param->poly  )
+                          && ( entry->param.refin == param->refin ) && ( entry->param.refout == param->refout ) ) {
+            slot = entry;
+            break;
+        }
+    }
+
+    if ( slot != NULL ) {
+        hexin_crc8_cache_hits++;
+    } else {
+        hexin_crc8_cache_misses++;
+        for ( i=0; i<HEXIN_CRC8_CACHE_SIZE; i++ ) {
+            entry = &hexin_crc8_cache[i];
+            if ( entry->refs != 0 ) {
+                continue;
+            }
+            if ( !entry->valid ) {
+                slot = entry;
+                break;
+            }
+            if ( ( slot == NULL ) || ( entry->used < slot->used ) ) {
+                slot = entry;
+            }
+        }
+
+        if ( slot == NULL ) {
+            hexin_crc8_compute_init( param );
+            return 0;
+        }
+
+        slot->valid             = FALSE;
+        slot->param.is_initial  = FALSE;
+        slot->param.width       = param->width;
+        slot->param.poly        = param->poly;
+        slot->param.refin       = param->refin;
+        slot->param.refout      = param->refout;
+        slot->valid = hexin_crc8_compute_init( &slot->param );
+    }
+
+    slot->used = ++hexin_crc8_cache_tick;
+    slot->refs++;
+    param->table = slot->param.table;
+    param->is_initial = TRUE;
+    return ( unsigned int )( slot - hexin_crc8_cache ) + 1;
+}
+
+void hexin_crc8_cache_release( unsigned int handle )
+{
+    if ( ( handle > 0 ) && ( handle <= HEXIN_CRC8_CACHE_SIZE ) && ( hexin_crc8_cache[handle - 1].refs > 0 ) ) {
+        hexin_crc8_cache[handle - 1].refs--;
+    }
+}
+
+void hexin_crc8_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count )
+{
+    unsigned int i = 0;
+
+    *hits   = hexin_crc8_cache_hits;
+    *misses = hexin_crc8_cache_misses;
+    *count  = 0;
+    for ( i=0; i<HEXIN_CRC8_CACHE_SIZE; i++ ) {
+        *count += hexin_crc8_cache[i].valid ? 1 : 0;
+    }
+}
+
+/* Drops every entry not in use and resets the counters. */
+void hexin_crc8_cache_clear( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; i<HEXIN_CRC8_CACHE_SIZE; i++ ) {
+        if ( hexin_crc8_cache[i].refs == 0 ) {
+            hexin_crc8_cache[i].valid = FALSE;
+        }
+    }
+    hexin_crc8_cache_hits   = 0;
+    hexin_crc8_cache_misses = 0;
+}
@@ -9,6 +9,11 @@
 * LICENSING TERMS:
 * ---------------
 *		New Create at 	2020-03-17 [Heyn] Initialize.
+*                      2026-10-17 [Heyn] New add hexin_crc8_compute_init().
+*                      2026-10-17 [Heyn] Catalogue tables come from the generated _crc8const.h.
+*                      2026-10-17 [Heyn] New add hacker table cache.
+*                      2026-10-17 [Heyn] HEXIN_CRC8_WIDTH is 8.
+*                      2026-10-17 [Heyn] bcc / lrc / sum / fletcher take a 64-bit length.
 *
 *********************************************************************************************************
 */
@@ -28,7 +33,12 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
-#define                 HEXIN_CRC8_WIDTH                        16
+#define                 HEXIN_CRC8_WIDTH                        8
+
+/* Number of hacker parameter tables kept by hexin_crc8_cache_acquire(). */
+#ifndef HEXIN_CRC8_CACHE_SIZE
+#define                 HEXIN_CRC8_CACHE_SIZE                   16
+#endif
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x80 )
@@ -53,7 +63,16 @@ struct _hexin_crc8 {
     unsigned int   refout;
     unsigned char  xorout;
     unsigned char  result;
-    unsigned char  table[MAX_TABLE_ARRAY];
+    const unsigned char  *table;
+    unsigned char  table_buffer[MAX_TABLE_ARRAY];
+};
+
+/* One entry of the generated _crc8const.h ( see src/gentables.py ). */
+struct _hexin_crc8_const {
+    unsigned int  width;
+    unsigned char  poly;
+    unsigned int  reflected;
+    const unsigned char  *table;
 };
 
 unsigned char hexin_reverse8( unsigned char data );
@@ -61,10 +80,16 @@ unsigned char hexin_reverse8( unsigned char data );
 unsigned int hexin_crc8_init_table_poly_is_high( unsigned char polynomial, unsigned char *table );
 unsigned int hexin_crc8_init_table_poly_is_low(  unsigned char polynomial, unsigned char *table );
 
-unsigned char hexin_calc_crc8_bcc(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_lrc(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_sum(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int len, unsigned char crc8 /*reserved*/ );
-unsigned char hexin_crc8_compute(       const unsigned char *pSrc, unsigned int len, struct _hexin_crc8 *param );
+unsigned char hexin_calc_crc8_bcc(      const unsigned char *pSrc, unsigned long long len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lrc(      const unsigned char *pSrc, unsigned long long len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_sum(      const unsigned char *pSrc, unsigned long long len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned long long len, unsigned char crc8 /*reserved*/ );
+unsigned int  hexin_crc8_compute_init( struct _hexin_crc8 *param );
+unsigned char hexin_crc8_compute(       const unsigned char *pSrc, unsigned long long len, const struct _hexin_crc8 *param );
+
+unsigned int hexin_crc8_cache_acquire( struct _hexin_crc8 *param );
+void hexin_crc8_cache_release( unsigned int handle );
+void hexin_crc8_cache_info( unsigned long long *hits, unsigned long long *misses, unsigned int *count );
+void hexin_crc8_cache_clear( void );
 
 #endif //__CRC8_TABLES_H__
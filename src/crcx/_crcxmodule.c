@@ -11,34 +11,64 @@
 *		New Create at 	2017-09-22 09:36AM
 *                       2020-03-17 [Heyn] Optimized code.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] Release the GIL on large buffers, New add _gil_threshold().
+*                       2026-10-17 [Heyn] Catalogue parameters moved to file scope and built once at module init.
+*                       2026-10-17 [Heyn] New add _catalogue(), the parameters behind every catalogue function.
+*                       2026-10-17 [Heyn] New add threads=N to the catalogue functions, large buffers are split over libscrc._model.
+*                       2026-10-17 [Heyn] Catalogue / hacker functions are METH_FASTCALL ( _modelargs.h ), results via PyLong_FromUnsignedLong.
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads().
+*                       2026-10-17 [Heyn] Fix buffers over 4 GB, the catalogue and hacker functions pass the whole 64-bit length.
 *
 *********************************************************************************************************
 */
 
 #include <Python.h>
 #include "_crcxtables.h"
+#include "_modelcapi.h"
+#include "_modelargs.h"
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crcx *param )
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_PARAMS,
+                                                      const struct _hexin_crcx *param, unsigned short *result )
 {
     Py_buffer data = { NULL, NULL };
+    unsigned int threads = 1;
+    unsigned long long value = 0;
+    const struct _hexin_model_capi *capi = NULL;
+    PyObject *slots[2];
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    static const char *const kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Unpack( HEXIN_FASTCALL_UNPACK, kwlist, 1, 1, slots ) || !hexin_PyArg_Threads( slots[1], &threads )
+      || !hexin_PyArg_Buffer( slots[0], &data ) ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+
+    if ( ( threads != 1 ) && ( data.len >= 2 * HEXIN_PARALLEL_MINSIZE ) ) {
+        capi = hexin_model_capi_import();
     }
-#endif /* PY_MAJOR_VERSION */
 
-    param->result = hexin_crcx_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param  );
+    if ( capi != NULL ) {
+        Py_BEGIN_ALLOW_THREADS
+        if ( capi->parallel( param->width, param->poly, param->init, param->xorout,
+                             HEXIN_REFIN_REFOUT_IS_TRUE( param ), HEXIN_REFIN_REFOUT_IS_TRUE( param ),
+                             (const unsigned char *)data.buf, (unsigned long long)data.len, threads, &value ) ) {
+            *result = ( unsigned short )value;
+        } else {
+            *result = hexin_crcx_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        }
+        Py_END_ALLOW_THREADS
+    } else if ( data.len >= hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crcx_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+        Py_END_ALLOW_THREADS
+    } else {
+        *result = hexin_crcx_compute( (const unsigned char *)data.buf, (unsigned long long)data.len, param  );
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -46,510 +76,657 @@ static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *
     return TRUE;
 }
 
-static PyObject * _crc3_gsm( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc3_param_gsm = { .is_initial=FALSE,
+                                             .width  = 3,
+                                             .poly   = 0x03,
+                                             .init   = 0x00,
+                                             .refin  = FALSE,
+                                             .refout = FALSE,
+                                             .xorout = 0x07,
+                                             .result = 0 };
+
+static PyObject * _crc3_gsm( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc3_param_gsm = { .is_initial=FALSE,
-                                                 .width  = 3,
-                                                 .poly   = 0x03,
-                                                 .init   = 0x00,
-                                                 .refin  = FALSE,
-                                                 .refout = FALSE,
-                                                 .xorout = 0x07,
-                                                 .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc3_param_gsm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc3_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc3_param_gsm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc3_rohc( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc3_param_rohc = { .is_initial=FALSE,
+                                              .width  = 3,
+                                              .poly   = 0x03,
+                                              .init   = 0x07,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc3_rohc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc3_param_rohc = { .is_initial=FALSE,
-                                                  .width  = 3,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x07,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc3_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc3_param_rohc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc3_param_rohc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc4_itu( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc4_param_itu4 = { .is_initial=FALSE,
+                                              .width  = 4,
+                                              .poly   = 0x03,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc4_itu( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc4_param_itu4 = { .is_initial=FALSE,
-                                                  .width  = 4,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc4_param_itu4 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc4_param_itu4, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc4_param_itu4.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc4_interlaken4( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc4_param_interlaken = { .is_initial=FALSE,
+                                                    .width  = 4,
+                                                    .poly   = 0x03,
+                                                    .init   = 0x0F,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x0F,
+                                                    .result = 0 };
+
+static PyObject * _crc4_interlaken4( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc4_param_interlaken = { .is_initial=FALSE,
-                                                        .width  = 4,
-                                                        .poly   = 0x03,
-                                                        .init   = 0x0F,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x0F,
-                                                        .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc4_param_interlaken ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc4_param_interlaken, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc4_param_interlaken.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc5_itu( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc5_param_itu5 = { .is_initial=FALSE,
+                                              .width  = 5,
+                                              .poly   = 0x15,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc5_itu( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc5_param_itu5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x15,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_itu5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc5_param_itu5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_itu5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc5_epc( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc5_param_epc5 = { .is_initial=FALSE,
+                                              .width  = 5,
+                                              .poly   = 0x09,
+                                              .init   = 0x09,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc5_epc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc5_param_epc5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x09,
-                                                  .init   = 0x09,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_epc5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc5_param_epc5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_epc5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc5_usb( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc5_param_usb5 = { .is_initial=FALSE,
+                                              .width  = 5,
+                                              .poly   = 0x05,
+                                              .init   = 0x1F,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x1F,
+                                              .result = 0 };
+
+static PyObject * _crc5_usb( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc5_param_usb5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x05,
-                                                  .init   = 0x1F,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x1F,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_usb5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc5_param_usb5, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_usb5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc6_itu( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc6_param_itu6 = { .is_initial=FALSE,
+                                              .width  = 6,
+                                              .poly   = 0x03,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc6_itu( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc6_param_itu6 = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_itu6 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc6_param_itu6, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_itu6.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc6_gsm( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc6_param_gsm6 = { .is_initial=FALSE,
+                                              .width  = 6,
+                                              .poly   = 0x2F,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x3F,
+                                              .result = 0 };
+
+static PyObject * _crc6_gsm( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc6_param_gsm6 = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x2F,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x3F,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_gsm6 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc6_param_gsm6, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_gsm6.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc6_darc6( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc6_param_darc = { .is_initial=FALSE,
+                                              .width  = 6,
+                                              .poly   = 0x19,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc6_darc6( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc6_param_darc = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x19,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc6_param_darc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_darc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc7_mmc( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc7_param_mmc7 = { .is_initial=FALSE,
+                                              .width  = 7,
+                                              .poly   = 0x09,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc7_mmc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc7_param_mmc7 = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x09,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_mmc7 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc7_param_mmc7, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_mmc7.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc7_umts7( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc7_param_umts = { .is_initial=FALSE,
+                                              .width  = 7,
+                                              .poly   = 0x45,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc7_umts7( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc7_param_umts = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x45,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_umts ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc7_param_umts, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_umts.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc7_rohc7( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc7_param_rohc = { .is_initial=FALSE,
+                                              .width  = 7,
+                                              .poly   = 0x4F,
+                                              .init   = 0x7F,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .result = 0 };
+
+static PyObject * _crc7_rohc7( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc7_param_rohc = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x4F,
-                                                  .init   = 0x7F,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc7_param_rohc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_rohc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc10_atm10( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc10_param_atm = { .is_initial=FALSE,
+                                              .width  = 10,
+                                              .poly   = 0x233,
+                                              .init   = 0x000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x000,
+                                              .result = 0 };
+
+static PyObject * _crc10_atm10( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc10_param_atm = { .is_initial=FALSE,
-                                                  .width  = 10,
-                                                  .poly   = 0x233,
-                                                  .init   = 0x000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x000,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_atm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc10_param_atm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_atm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc10_cdma2000( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc10_param_cdma2000 = { .is_initial=FALSE,
+                                                   .width  = 10,
+                                                   .poly   = 0x3D9,
+                                                   .init   = 0x3FF,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x000,
+                                                   .result = 0 };
+
+static PyObject * _crc10_cdma2000( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc10_param_cdma2000 = { .is_initial=FALSE,
-                                                       .width  = 10,
-                                                       .poly   = 0x3D9,
-                                                       .init   = 0x3FF,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc10_param_cdma2000, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_cdma2000.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc10_gsm10( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc10_param_gsm10 = { .is_initial=FALSE,
+                                                .width  = 10,
+                                                .poly   = 0x175,
+                                                .init   = 0x000,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x3FF,
+                                                .result = 0 };
+
+static PyObject * _crc10_gsm10( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc10_param_gsm10 = { .is_initial=FALSE,
-                                                    .width  = 10,
-                                                    .poly   = 0x175,
-                                                    .init   = 0x000,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x3FF,
-                                                    .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_gsm10 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc10_param_gsm10, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_gsm10.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc11_flexray11( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc11_param_flexray = { .is_initial=FALSE,
+                                                  .width  = 11,
+                                                  .poly   = 0x385,
+                                                  .init   = 0x01A,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x000,
+                                                  .result = 0 };
+
+static PyObject * _crc11_flexray11( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc11_param_flexray = { .is_initial=FALSE,
-                                                      .width  = 11,
-                                                      .poly   = 0x385,
-                                                      .init   = 0x01A,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc11_param_flexray ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc11_param_flexray, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc11_param_flexray.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc11_umts11( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc11_param_umts11 = { .is_initial=FALSE,
+                                                 .width  = 11,
+                                                 .poly   = 0x307,
+                                                 .init   = 0x000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x000,
+                                                 .result = 0 };
+
+static PyObject * _crc11_umts11( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc11_param_umts11 = { .is_initial=FALSE,
-                                                     .width  = 11,
-                                                     .poly   = 0x307,
-                                                     .init   = 0x000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc11_param_umts11 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc11_param_umts11, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc11_param_umts11.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_cdma2000( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc12_param_cdma2000 = { .is_initial=FALSE,
+                                                   .width  = 12,
+                                                   .poly   = 0xF13,
+                                                   .init   = 0xFFF,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x000,
+                                                   .result = 0 };
+
+static PyObject * _crc12_cdma2000( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_cdma2000 = { .is_initial=FALSE,
-                                                       .width  = 12,
-                                                       .poly   = 0xF13,
-                                                       .init   = 0xFFF,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc12_param_cdma2000, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_cdma2000.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_dect12( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc12_param_dect = { .is_initial=FALSE,
+                                               .width  = 12,
+                                               .poly   = 0x80F,
+                                               .init   = 0x000,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x000,
+                                               .result = 0 };
+
+static PyObject * _crc12_dect12( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_dect = { .is_initial=FALSE,
-                                                   .width  = 12,
-                                                   .poly   = 0x80F,
-                                                   .init   = 0x000,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x000,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_dect ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc12_param_dect, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_dect.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_gsm12( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc12_param_gsm = { .is_initial=FALSE,
+                                              .width  = 12,
+                                              .poly   = 0xD31,
+                                              .init   = 0x000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0xFFF,
+                                              .result = 0 };
+
+static PyObject * _crc12_gsm12( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_gsm = { .is_initial=FALSE,
-                                                  .width  = 12,
-                                                  .poly   = 0xD31,
-                                                  .init   = 0x000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0xFFF,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_gsm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc12_param_gsm, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_gsm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_umts12( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc12_param_umts12 = { .is_initial=FALSE,
+                                                 .width  = 12,
+                                                 .poly   = 0x80F,
+                                                 .init   = 0x000,
+                                                 .refin  = FALSE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0x000,
+                                                 .result = 0 };
+
+static PyObject * _crc12_umts12( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_umts12 = { .is_initial=FALSE,
-                                                     .width  = 12,
-                                                     .poly   = 0x80F,
-                                                     .init   = 0x000,
-                                                     .refin  = FALSE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0x000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_umts12 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc12_param_umts12, &result ) ) {
         return NULL;
     }
 
     /* TODO : refin=False, refout=True */
-    crc12_param_umts12.result = hexin_crcx_reverse12( crc12_param_umts12.result );
+    result = hexin_crcx_reverse12( result );
 
-    return Py_BuildValue( "H", crc12_param_umts12.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc13_bbc( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc13_param_bbc = { .is_initial=FALSE,
+                                              .width  = 13,
+                                              .poly   = 0x1CF5,
+                                              .init   = 0x0000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x0000,
+                                              .result = 0 };
+
+static PyObject * _crc13_bbc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc13_param_bbc = { .is_initial=FALSE,
-                                                  .width  = 13,
-                                                  .poly   = 0x1CF5,
-                                                  .init   = 0x0000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x0000,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc13_param_bbc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc13_param_bbc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc13_param_bbc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc14_darc( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc14_param_darc = { .is_initial=FALSE,
+                                               .width  = 14,
+                                               .poly   = 0x0805,
+                                               .init   = 0x0000,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x0000,
+                                               .result = 0 };
+
+static PyObject * _crc14_darc( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc14_param_darc = { .is_initial=FALSE,
-                                                   .width  = 14,
-                                                   .poly   = 0x0805,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x0000,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc14_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc14_param_darc, &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc14_param_darc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc14_gsm( PyObject *self, PyObject *args )
+static struct _hexin_crcx crc14_param_gsm = { .is_initial=FALSE,
+                                              .width  = 14,
+                                              .poly   = 0x202D,
+                                              .init   = 0x0000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x3FFF,
+                                              .result = 0 };
+
+static PyObject * _crc14_gsm( HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc14_param_gsm = { .is_initial=FALSE,
-                                                  .width  = 14,
-                                                  .poly   = 0x202D,
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc14_param_gsm, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static struct _hexin_crcx crc15_param_mpt1327 = { .is_initial=FALSE,
+                                                  .width  = 15,
+                                                  .poly   = 0x6815,
                                                   .init   = 0x0000,
                                                   .refin  = FALSE,
                                                   .refout = FALSE,
-                                                  .xorout = 0x3FFF,
+                                                  .xorout = 0x0001,
                                                   .result = 0 };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc14_param_gsm ) ) {
+static PyObject * _crc15_mpt1327( HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( HEXIN_FASTCALL_ARGS, &crc15_param_mpt1327, &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static PyObject * _crcx_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc14_param_gsm.result );
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+/* Catalogue parameters by function name, their tables are built in module init and never written again. */
+static struct _hexin_crcx_catalogue {
+    const char          *name;
+    struct _hexin_crcx  *param;
+} hexin_crcx_params[] = {
+    { "gsm3",           &crc3_param_gsm },
+    { "rohc3",          &crc3_param_rohc },
+    { "itu4",           &crc4_param_itu4 },
+    { "g_704",          &crc4_param_itu4 },
+    { "itu5",           &crc5_param_itu5 },
+    { "epc",            &crc5_param_epc5 },
+    { "usb5",           &crc5_param_usb5 },
+    { "itu6",           &crc6_param_itu6 },
+    { "gsm6",           &crc6_param_gsm6 },
+    { "darc6",          &crc6_param_darc },
+    { "mmc",            &crc7_param_mmc7 },
+    { "crc7",           &crc7_param_mmc7 },
+    { "umts7",          &crc7_param_umts },
+    { "rohc7",          &crc7_param_rohc },
+    { "atm10",          &crc10_param_atm },
+    { "gsm10",          &crc10_param_gsm10 },
+    { "umts11",         &crc11_param_umts11 },
+    { "dect12",         &crc12_param_dect },
+    { "gsm12",          &crc12_param_gsm },
+    { "umts12",         &crc12_param_umts12 },
+    { "crc12",          &crc12_param_dect },
+    { "bbc13",          &crc13_param_bbc },
+    { "darc14",         &crc14_param_darc },
+    { "gsm14",          &crc14_param_gsm },
+    { "crc12_3gpp",     &crc12_param_umts12 },
+    { "mpt1327",        &crc15_param_mpt1327 },
+    { "flexray11",      &crc11_param_flexray },
+    { "crc10_cdma2000", &crc10_param_cdma2000 },
+    { "crc12_cdma2000", &crc12_param_cdma2000 },
+    { "interlaken4",    &crc4_param_interlaken },
+    { NULL, NULL }
+};
+
+static void hexin_crcx_params_init( void )
+{
+    unsigned int i = 0;
+
+    for ( i=0; hexin_crcx_params[i].name != NULL; i++ ) {
+        hexin_crcx_compute_init( hexin_crcx_params[i].param );
+    }
 }
 
-static PyObject * _crc15_mpt1327( PyObject *self, PyObject *args )
+static PyObject * _crcx_catalogue( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crcx crc15_param_mpt1327 = { .is_initial=FALSE,
-                                                      .width  = 15,
-                                                      .poly   = 0x6815,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0001,
-                                                      .result = 0 };
+    unsigned int i = 0;
+    PyObject *pdict = PyDict_New();
+    PyObject *pitem = NULL;
+    const struct _hexin_crcx *param = NULL;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc15_param_mpt1327 ) ) {
+    if ( pdict == NULL ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc15_param_mpt1327.result );
+    for ( i=0; hexin_crcx_params[i].name != NULL; i++ ) {
+        param = hexin_crcx_params[i].param;
+        pitem = Py_BuildValue( "(IKKKNN)", ( unsigned int )param->width,
+                                           ( unsigned long long )param->poly,
+                                           ( unsigned long long )param->init,
+                                           ( unsigned long long )param->xorout,
+                                           PyBool_FromLong( param->refin  ),
+                                           PyBool_FromLong( param->refout ) );
+        if ( ( pitem == NULL ) || ( PyDict_SetItemString( pdict, hexin_crcx_params[i].name, pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    return pdict;
 }
 
 /* method table */
 static PyMethodDef _crcxMethods[] = {
-    { "gsm3",    _crc3_gsm,          METH_VARARGS, "Calculate GSM  of CRC3 [Poly=0x03 Initial=0x00 Xorout=0x07 Refin=False Refout=False]" },
-    { "rohc3",   _crc3_rohc,         METH_VARARGS, "Calculate ROHC of CRC3 [Poly=0x03 Initial=0x07 Xorout=0x00 Refin=True Refout=True]" },
-    { "itu4",    _crc4_itu,          METH_VARARGS, "Calculate ITU  of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "g_704",   _crc4_itu,          METH_VARARGS, "Calculate G-704 of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "itu5",    _crc5_itu,          METH_VARARGS, "Calculate ITU  of CRC5 [Poly=0x15 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "epc",     _crc5_epc,          METH_VARARGS, "Calculate EPC  of CRC5 [Poly=0x09 Initial=0x09 Xorout=0x00 Refin=False Refout=False]" },
-    { "usb5",    _crc5_usb,          METH_VARARGS, "Calculate USB  of CRC5 [Poly=0x05 Initial=0x1F Xorout=0x1F Refin=True Refout=True]" },
-    { "itu6",    _crc6_itu,          METH_VARARGS, "Calculate ITU  of CRC6 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "gsm6",    _crc6_gsm,          METH_VARARGS, "Calculate GSM  of CRC6 [Poly=0x2F Initial=0x00 Xorout=0x3F Refin=False Refout=False]" },
-    { "darc6",   _crc6_darc6,        METH_VARARGS, "Calculate ROHC of CRC6 [Poly=0x19 Initial=0x00 Xorout=0x00 Refin=True Refout=True]"   },
-    { "mmc",     _crc7_mmc,          METH_VARARGS, "Calculate MMC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "crc7",    _crc7_mmc,          METH_VARARGS, "Calculate CRC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "umts7",   _crc7_umts7,        METH_VARARGS, "Calculate UMTS of CRC7 [Poly=0x45 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "rohc7",   _crc7_rohc7,        METH_VARARGS, "Calculate ROHC of CRC7 [Poly=0x4F Initial=0x7F Xorout=0x00 Refin=True Refout=True]"   },
-    { "atm10",   _crc10_atm10,       METH_VARARGS, "Calculate ATM of CRC10 [Poly=0x233 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "gsm10",   _crc10_gsm10,       METH_VARARGS, "Calculate GSM of CRC10 [Poly=0x175 Initial=0x000 Refin=False Refout=False Xorout=0x3FF]"   },
-    { "umts11",  _crc11_umts11,      METH_VARARGS, "Calculate UMTS of CRC11 [Poly=0x307 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "dect12",  _crc12_dect12,      METH_VARARGS, "Calculate DECT of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "gsm12",   _crc12_gsm12,       METH_VARARGS, "Calculate GSM of CRC12 [Poly=0xD31 Initial=0x000 Refin=False Refout=False Xorout=0xFFF]"   },
-    { "umts12",  _crc12_umts12,      METH_VARARGS, "Calculate UMTS of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
-    { "crc12",   _crc12_dect12,      METH_VARARGS, "Calculate X-CRC12 of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "bbc13",   _crc13_bbc,         METH_VARARGS, "Calculate BBC of CRC13 [Poly=0x1CF5 Initial=0x0000 Refin=False Refout=False Xorout=0x0000]"   },
-    { "darc14",  _crc14_darc,        METH_VARARGS, "Calculate DARC of CRC14 [Poly=0x0805 Initial=0x0000 Refin=False Refout=true Xorout=0x0000]"   },
-    { "gsm14",   _crc14_gsm,         METH_VARARGS, "Calculate GSM of CRC14 [Poly=0x202D Initial=0x0000 Refin=False Refout=False Xorout=0x3FFF]"   },
+    { "gsm3",    (PyCFunction)_crc3_gsm,          HEXIN_METH_FASTCALL, "Calculate GSM  of CRC3 [Poly=0x03 Initial=0x00 Xorout=0x07 Refin=False Refout=False]" },
+    { "rohc3",   (PyCFunction)_crc3_rohc,         HEXIN_METH_FASTCALL, "Calculate ROHC of CRC3 [Poly=0x03 Initial=0x07 Xorout=0x00 Refin=True Refout=True]" },
+    { "itu4",    (PyCFunction)_crc4_itu,          HEXIN_METH_FASTCALL, "Calculate ITU  of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "g_704",   (PyCFunction)_crc4_itu,          HEXIN_METH_FASTCALL, "Calculate G-704 of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "itu5",    (PyCFunction)_crc5_itu,          HEXIN_METH_FASTCALL, "Calculate ITU  of CRC5 [Poly=0x15 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "epc",     (PyCFunction)_crc5_epc,          HEXIN_METH_FASTCALL, "Calculate EPC  of CRC5 [Poly=0x09 Initial=0x09 Xorout=0x00 Refin=False Refout=False]" },
+    { "usb5",    (PyCFunction)_crc5_usb,          HEXIN_METH_FASTCALL, "Calculate USB  of CRC5 [Poly=0x05 Initial=0x1F Xorout=0x1F Refin=True Refout=True]" },
+    { "itu6",    (PyCFunction)_crc6_itu,          HEXIN_METH_FASTCALL, "Calculate ITU  of CRC6 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "gsm6",    (PyCFunction)_crc6_gsm,          HEXIN_METH_FASTCALL, "Calculate GSM  of CRC6 [Poly=0x2F Initial=0x00 Xorout=0x3F Refin=False Refout=False]" },
+    { "darc6",   (PyCFunction)_crc6_darc6,        HEXIN_METH_FASTCALL, "Calculate ROHC of CRC6 [Poly=0x19 Initial=0x00 Xorout=0x00 Refin=True Refout=True]"   },
+    { "mmc",     (PyCFunction)_crc7_mmc,          HEXIN_METH_FASTCALL, "Calculate MMC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "crc7",    (PyCFunction)_crc7_mmc,          HEXIN_METH_FASTCALL, "Calculate CRC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "umts7",   (PyCFunction)_crc7_umts7,        HEXIN_METH_FASTCALL, "Calculate UMTS of CRC7 [Poly=0x45 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "rohc7",   (PyCFunction)_crc7_rohc7,        HEXIN_METH_FASTCALL, "Calculate ROHC of CRC7 [Poly=0x4F Initial=0x7F Xorout=0x00 Refin=True Refout=True]"   },
+    { "atm10",   (PyCFunction)_crc10_atm10,       HEXIN_METH_FASTCALL, "Calculate ATM of CRC10 [Poly=0x233 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "gsm10",   (PyCFunction)_crc10_gsm10,       HEXIN_METH_FASTCALL, "Calculate GSM of CRC10 [Poly=0x175 Initial=0x000 Refin=False Refout=False Xorout=0x3FF]"   },
+    { "umts11",  (PyCFunction)_crc11_umts11,      HEXIN_METH_FASTCALL, "Calculate UMTS of CRC11 [Poly=0x307 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "dect12",  (PyCFunction)_crc12_dect12,      HEXIN_METH_FASTCALL, "Calculate DECT of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "gsm12",   (PyCFunction)_crc12_gsm12,       HEXIN_METH_FASTCALL, "Calculate GSM of CRC12 [Poly=0xD31 Initial=0x000 Refin=False Refout=False Xorout=0xFFF]"   },
+    { "umts12",  (PyCFunction)_crc12_umts12,      HEXIN_METH_FASTCALL, "Calculate UMTS of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
+    { "crc12",   (PyCFunction)_crc12_dect12,      HEXIN_METH_FASTCALL, "Calculate X-CRC12 of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "bbc13",   (PyCFunction)_crc13_bbc,         HEXIN_METH_FASTCALL, "Calculate BBC of CRC13 [Poly=0x1CF5 Initial=0x0000 Refin=False Refout=False Xorout=0x0000]"   },
+    { "darc14",  (PyCFunction)_crc14_darc,        HEXIN_METH_FASTCALL, "Calculate DARC of CRC14 [Poly=0x0805 Initial=0x0000 Refin=False Refout=true Xorout=0x0000]"   },
+    { "gsm14",   (PyCFunction)_crc14_gsm,         HEXIN_METH_FASTCALL, "Calculate GSM of CRC14 [Poly=0x202D Initial=0x0000 Refin=False Refout=False Xorout=0x3FFF]"   },
     
-    { "crc12_3gpp",         _crc12_umts12,      METH_VARARGS, "Calculate 3GPP of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
-    { "mpt1327",            _crc15_mpt1327,     METH_VARARGS, "Calculate MPT1327 of CRC15 [Poly=0x6815 Initial=0x0000 Refin=False Refout=False Xorout=0x0001]"   },
-    { "flexray11",          _crc11_flexray11,   METH_VARARGS, "Calculate FLEXRAY of CRC11 [Poly=0x385 Initial=0x01a Refin=False Refout=False Xorout=0x000]"   },
-    { "crc10_cdma2000",     _crc10_cdma2000,    METH_VARARGS, "Calculate CDMA2000 of CRC10  [Poly=0x3D9 Initial=0x3FF Refin=False Refout=False Xorout=0x000]"   },
-    { "crc12_cdma2000",     _crc12_cdma2000,    METH_VARARGS, "Calculate CDMA2000 of CRC12  [Poly=0xF13 Initial=0xFFF Refin=False Refout=False Xorout=0x000]"   },
-    { "interlaken4",        _crc4_interlaken4,  METH_VARARGS, "Calculate INTERLAKEN of CRC4 [Poly=0x03 Initial=0x0F Xorout=0x0F Refin=False Refout=False]" },
+    { "crc12_3gpp",         (PyCFunction)_crc12_umts12,      HEXIN_METH_FASTCALL, "Calculate 3GPP of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
+    { "mpt1327",            (PyCFunction)_crc15_mpt1327,     HEXIN_METH_FASTCALL, "Calculate MPT1327 of CRC15 [Poly=0x6815 Initial=0x0000 Refin=False Refout=False Xorout=0x0001]"   },
+    { "flexray11",          (PyCFunction)_crc11_flexray11,   HEXIN_METH_FASTCALL, "Calculate FLEXRAY of CRC11 [Poly=0x385 Initial=0x01a Refin=False Refout=False Xorout=0x000]"   },
+    { "crc10_cdma2000",     (PyCFunction)_crc10_cdma2000,    HEXIN_METH_FASTCALL, "Calculate CDMA2000 of CRC10  [Poly=0x3D9 Initial=0x3FF Refin=False Refout=False Xorout=0x000]"   },
+    { "crc12_cdma2000",     (PyCFunction)_crc12_cdma2000,    HEXIN_METH_FASTCALL, "Calculate CDMA2000 of CRC12  [Poly=0xF13 Initial=0xFFF Refin=False Refout=False Xorout=0x000]"   },
+    { "interlaken4",        (PyCFunction)_crc4_interlaken4,  HEXIN_METH_FASTCALL, "Calculate INTERLAKEN of CRC4 [Poly=0x03 Initial=0x0F Xorout=0x0F Refin=False Refout=False]" },
+    { "_gil_threshold", (PyCFunction)_crcx_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { "_catalogue",     (PyCFunction)_crcx_catalogue,     METH_NOARGS,  "Catalogue parameters by function name {name: (width, poly, init, xorout, refin, refout)}" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -591,6 +768,8 @@ PyInit__crcx( void )
 {
     PyObject *m = NULL;
 
+    hexin_crcx_params_init();
+
     m = PyModule_Create( &_crcxmodule );
     if ( m == NULL ) {
         return NULL;
@@ -608,6 +787,7 @@ PyInit__crcx( void )
 PyMODINIT_FUNC
 init_crcx( void )
 {
+    hexin_crcx_params_init();
     (void) Py_InitModule3( "_crcx", _crcxMethods, _crcx_doc );
 }
 
@@ -12,12 +12,32 @@
 *		New Create at 	2017-09-22 09:36AM
 *                       2020-03-17 [Heyn] Optimized code.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] Split out hexin_crcx_compute_init(), param->poly is left unchanged.
+*                       2026-10-17 [Heyn] Look up the generated constant tables before building one.
+*                       2026-10-17 [Heyn] hexin_crcx_compute() takes a 64-bit length, buffers over 4 GB are no longer cut short.
 *
 *********************************************************************************************************
 */
 
 #include "_crcxtables.h"
 
+#if defined( HEXIN_CONST_TABLES )
+#include "_crcxconst.h"
+
+static const struct _hexin_crcx_const *hexin_crcx_const_lookup( const struct _hexin_crcx *param )
+{
+    const struct _hexin_crcx_const *entry = NULL;
+    unsigned int reflected = HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? TRUE : FALSE;
+
+    for ( entry=hexin_crcx_const_tables; entry->table != NULL; entry++ ) {
+        if ( ( entry->width == param->width ) && ( entry->poly == param->poly ) && ( entry->reflected == reflected ) ) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+#endif /* HEXIN_CONST_TABLES */
+
 unsigned short hexin_crcx_reverse12( unsigned short data )
 {
     unsigned int   i = 0;
@@ -38,7 +58,7 @@ static unsigned short hexin_crcx_reverse16( unsigned short data )
     return t;
 }
 
-static unsigned int hexin_crcx_compute_init_table( struct _hexin_crcx *param )
+static unsigned int hexin_crcx_compute_init_table( struct _hexin_crcx *param, unsigned short polynomial )
 {
     unsigned int i = 0, j = 0;
     unsigned short crc = 0, c = 0;
@@ -48,28 +68,29 @@ static unsigned int hexin_crcx_compute_init_table( struct _hexin_crcx *param )
             crc = 0;
             c   = ( unsigned short ) i;
             for ( j=0; j<8; j++ ) {
-                if ( (crc ^ c) & 0x0001 )   crc = ( crc >> 1 ) ^ param->poly;
+                if ( (crc ^ c) & 0x0001 )   crc = ( crc >> 1 ) ^ polynomial;
                 else                        crc =   crc >> 1;
                 c = c >> 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c   = ( ( unsigned short ) i ) << 8;
             for ( j=0; j<8; j++ ) {
-                if ( (crc ^ c) & 0x8000 ) crc = ( crc << 1 ) ^ param->poly;
+                if ( (crc ^ c) & 0x8000 ) crc = ( crc << 1 ) ^ polynomial;
                 else                      crc =   crc << 1;
                 c = c << 1;
             }
-            param->table[i] = crc;
+            param->table_buffer[i] = crc;
         }
     }
+    param->table = param->table_buffer;
     return TRUE;
 }
 
-static unsigned short hexin_crcx_compute_char( unsigned short crcx, unsigned char c, struct _hexin_crcx *param )
+static unsigned short hexin_crcx_compute_char( unsigned short crcx, unsigned char c, const struct _hexin_crcx *param )
 {
     unsigned short crc = crcx;
 
@@ -82,20 +103,43 @@ static unsigned short hexin_crcx_compute_char( unsigned short crcx, unsigned cha
     return crc;
 }
 
-unsigned short hexin_crcx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crcx *param )
+/* Build the table once, the parameter is read-only afterwards. */
+unsigned int hexin_crcx_compute_init( struct _hexin_crcx *param )
 {
-    unsigned int i = 0, result = 0;
     unsigned int offset = ( HEXIN_CRCX_WIDTH - param->width );
-    unsigned short crc  = ( param->init << offset );
+    unsigned short poly = param->poly;
+#if defined( HEXIN_CONST_TABLES )
+    const struct _hexin_crcx_const *entry = NULL;
+#endif
 
-    if ( param->is_initial == FALSE ) {
-        if ( HEXIN_REFIN_REFOUT_IS_TRUE( param )  ) {
-            param->poly = ( hexin_crcx_reverse16( param->poly ) >> offset );
-        } else {
-            param->poly = ( param->poly << offset );
-        }
-        param->is_initial = hexin_crcx_compute_init_table( param );
+    if ( param->is_initial == TRUE ) {
+        return TRUE;
+    }
+
+#if defined( HEXIN_CONST_TABLES )
+    entry = hexin_crcx_const_lookup( param );
+    if ( entry != NULL ) {
+        param->table = entry->table;
+        param->is_initial = TRUE;
+        return TRUE;
+    }
+#endif
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param )  ) {
+        poly = ( hexin_crcx_reverse16( param->poly ) >> offset );
+    } else {
+        poly = ( param->poly << offset );
     }
+    param->is_initial = hexin_crcx_compute_init_table( param, poly );
+    return param->is_initial;
+}
+
+unsigned short hexin_crcx_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crcx *param )
+{
+    unsigned long long i = 0;
+    unsigned int result = 0;
+    unsigned int offset = ( HEXIN_CRCX_WIDTH - param->width );
+    unsigned short crc  = ( param->init << offset );
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) { 
         crc = hexin_crcx_reverse16( crc );
@@ -11,6 +11,8 @@
 *		New Create at 	2017-09-22 09:36AM
 *                       2020-03-17 [Heyn] Optimized code.
 *                       2020-04-27 [Heyn] Optimized code.
+*                       2026-10-17 [Heyn] New add hexin_crcx_compute_init().
+*                       2026-10-17 [Heyn] Catalogue tables come from the generated _crcxconst.h.
 *
 *********************************************************************************************************
 */
@@ -43,10 +45,20 @@ struct _hexin_crcx {
     unsigned int    refout;
     unsigned short  xorout;
     unsigned short  result;
-    unsigned short  table[MAX_TABLE_ARRAY];
+    const unsigned short  *table;
+    unsigned short  table_buffer[MAX_TABLE_ARRAY];
+};
+
+/* One entry of the generated _crcxconst.h ( see src/gentables.py ). */
+struct _hexin_crcx_const {
+    unsigned int  width;
+    unsigned short  poly;
+    unsigned int  reflected;
+    const unsigned short  *table;
 };
 
 unsigned short hexin_crcx_reverse12( unsigned short data );
-unsigned short hexin_crcx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crcx *param );
+unsigned int   hexin_crcx_compute_init( struct _hexin_crcx *param );
+unsigned short hexin_crcx_compute( const unsigned char *pSrc, unsigned long long len, const struct _hexin_crcx *param );
 
 #endif //__CRCX_TABLES_H__
@@ -0,0 +1,213 @@
+# -*- coding:utf-8 -*-
+""" Generate constant CRC tables for the libscrc catalogue. """
+# !/usr/bin/python
+# Python:   2.7/3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Author:   Heyn (heyunhuan@gmail.com)
+# Program:  Read every catalogue parameter from src/*/_*module.c and write
+#           src/*/_*const.h with the lookup tables as static const data.
+#           Models sharing a polynomial and reflection share one table.
+# History:  2026-10-17 Wheel Ver:1.3 [Heyn] Initialize
+#           2026-10-17 Wheel Ver:1.3 [Heyn] CRC64 gets the slicing-by-8 tables too.
+#           2026-10-17 Wheel Ver:1.3 [Heyn] CRC64 gets the PCLMULQDQ fold constants too.
+#           2026-10-17 Wheel Ver:1.3 [Heyn] So does CRC16.
+
+from __future__ import unicode_literals
+
+import io
+import os
+import re
+import sys
+
+# name : ( C type, register bits, top bit of the MSB-first table, normalize, slices, fold )
+#   normalize='offset'  : reflected reverse( poly, bits ) >> offset, else poly << offset.
+#   normalize='reverse' : reflected reverse( poly, top ), else poly.
+ENGINES = {
+    'crcx'  : ( 'unsigned short',     16, 16, 'offset',  1, False ),
+    'canx'  : ( 'unsigned int',       32, 32, 'offset',  1, False ),
+    'crc8'  : ( 'unsigned char',      8,  8,  'reverse', 1, False ),
+    'crc16' : ( 'unsigned short',     16, 16, 'reverse', 1, True  ),
+    'crc24' : ( 'unsigned int',       32, 24, 'reverse', 1, False ),
+    'crc32' : ( 'unsigned int',       32, 32, 'offset',  8, True  ),
+    'crc64' : ( 'unsigned long long', 64, 64, 'offset',  8, True  ),
+}
+
+FOLD_DISTANCE = ( 512, 384, 256, 128 )
+
+RE_DEFINE = re.compile( r'^#define\s+(\w+)\s+(0x[0-9A-Fa-f]+|\d+)L*\s*$', re.M )
+RE_PARAM  = re.compile( r'static struct _hexin_(\w+) (\w+) = \{(.*?)\};', re.S )
+RE_FIELD  = re.compile( r'\.(\w+)\s*=\s*([^,}\s]+)' )
+
+
+def reverse( value, bits ):
+    result = 0
+    for i in range( bits ):
+        result |= ( ( value >> i ) & 1 ) << ( bits - 1 - i )
+    return result
+
+
+def normalize( engine, width, poly, reflected ):
+    _, reg, top, kind, _, _ = ENGINES[engine]
+    mask = ( 1 << top ) - 1
+    if kind == 'offset':
+        offset = top - width
+        return ( reverse( poly & mask, top ) >> offset ) if reflected else ( ( poly << offset ) & mask )
+    return reverse( poly & mask, top ) if reflected else ( poly & mask )
+
+
+def make_table( engine, poly, reflected ):
+    _, reg, top, _, slices, _ = ENGINES[engine]
+    mask  = ( 1 << reg ) - 1
+    table = [ [] ]
+    for i in range( 256 ):
+        if reflected:
+            crc = i
+            for _ in range( 8 ):
+                crc = ( crc >> 1 ) ^ poly if crc & 1 else crc >> 1
+        else:
+            crc, c = 0, i << ( top - 8 )
+            for _ in range( 8 ):
+                crc = ( ( crc << 1 ) ^ poly ) if ( crc ^ c ) & ( 1 << ( top - 1 ) ) else ( crc << 1 )
+                crc &= mask
+                c <<= 1
+        table[0].append( crc )
+
+    # table[j][i] = CRC of byte i followed by j zero bytes.
+    for j in range( 1, slices ):
+        row = []
+        for i in range( 256 ):
+            crc = table[j - 1][i]
+            if reflected:
+                crc = ( crc >> 8 ) ^ table[0][crc & 0xFF]
+            else:
+                crc = ( ( crc << 8 ) & mask ) ^ table[0][crc >> ( top - 8 )]
+            row.append( crc )
+        table.append( row )
+    return table
+
+
+def xpow_mod( n, poly, bits ):
+    """ x^n mod ( x^bits + poly ), poly in MSB-first form. """
+    r, top, mask = 1, 1 << ( bits - 1 ), ( 1 << bits ) - 1
+    for _ in range( n ):
+        r = ( ( r << 1 ) ^ poly ) & mask if r & top else ( r << 1 ) & mask
+    return r
+
+
+def make_fold( engine, width, poly, reflected ):
+    _, reg, top, _, _, _ = ENGINES[engine]
+    poly = ( poly << ( top - width ) ) & ( ( 1 << top ) - 1 )
+    fold = []
+    for d in FOLD_DISTANCE:
+        if reflected:
+            fold.append( reverse( xpow_mod( d + 63, poly, top ), top ) << ( 64 - top ) )
+            fold.append( reverse( xpow_mod( d - 1,  poly, top ), top ) << ( 64 - top ) )
+        else:
+            fold.append( xpow_mod( d,      poly, top ) )
+            fold.append( xpow_mod( d + 64, poly, top ) )
+    return fold
+
+
+def read_catalogue( root, engine ):
+    folder  = os.path.join( root, engine )
+    defines = { 'TRUE' : 1, 'FALSE' : 0 }
+    sources = [ os.path.join( folder, name ) for name in sorted( os.listdir( folder ) ) if name.endswith( ( '.h', '.c' ) ) ]
+    texts   = [ io.open( name, encoding='utf-8', errors='ignore' ).read() for name in sources ]
+
+    for text in texts:
+        for name, value in RE_DEFINE.findall( text ):
+            defines[name] = int( value, 0 )
+
+    def evaluate( token ):
+        token = token.strip()
+        if token in defines:
+            return defines[token]
+        return int( token.rstrip( 'Ll' ), 0 )
+
+    catalogue = []
+    module = io.open( os.path.join( folder, '_%smodule.c' % engine ), encoding='utf-8', errors='ignore' ).read()
+    for kind, name, body in RE_PARAM.findall( module ):
+        if kind != engine:
+            continue
+        fields = dict( ( key, evaluate( value ) ) for key, value in RE_FIELD.findall( body ) )
+        reflected = bool( fields['refin'] and fields['refout'] )
+        catalogue.append( ( name, fields['width'], fields['poly'], reflected ) )
+    return catalogue
+
+
+def literal( ctype, value ):
+    digits = { 'unsigned char' : 2, 'unsigned short' : 4, 'unsigned int' : 8, 'unsigned long long' : 16 }[ctype]
+    suffix = { 'unsigned int' : 'L', 'unsigned long long' : 'ULL' }.get( ctype, '' )
+    return '0x%0*X%s' % ( digits, value, suffix )
+
+
+def emit_array( ctype, values ):
+    per_line = 8 if len( literal( ctype, 0 ) ) <= 11 else 4
+    lines = []
+    for i in range( 0, len( values ), per_line ):
+        lines.append( '    ' + ', '.join( literal( ctype, v ) for v in values[i:i + per_line] ) )
+    return ',\n'.join( lines )
+
+
+def render( engine, catalogue ):
+    ctype, _, top, _, slices, fold = ENGINES[engine]
+    out = [ '/*',
+            ' * Generated by src/gentables.py from _%smodule.c, do not edit.' % engine,
+            ' */',
+            '',
+            '#ifndef __%s_CONST_H__' % engine.upper(),
+            '#define __%s_CONST_H__' % engine.upper(),
+            '',
+            '#include <stddef.h>',
+            '' ]
+
+    tables, entries = {}, []
+    for name, width, poly, reflected in catalogue:
+        key = ( width, poly, reflected )
+        if key in [ e[0] for e in entries ]:
+            continue
+        normal = normalize( engine, width, poly, reflected )
+        symbol = 'hexin_%s_const_%0*X_%s' % ( engine, top // 4, normal, 'ref' if reflected else 'msb' )
+        if ( normal, reflected ) not in tables:
+            tables[( normal, reflected )] = symbol
+            table = make_table( engine, normal, reflected )
+            if slices > 1:
+                out.append( 'static const %s %s_table[%d][MAX_TABLE_ARRAY] = {' % ( ctype, symbol, slices ) )
+                out.append( ',\n'.join( '  {\n' + emit_array( ctype, row ) + '\n  }' for row in table ) )
+            else:
+                out.append( 'static const %s %s_table[MAX_TABLE_ARRAY] = {' % ( ctype, symbol ) )
+                out.append( emit_array( ctype, table[0] ) )
+            out.append( '};' )
+            out.append( '' )
+            if fold:
+                out.append( 'static const unsigned long long %s_fold[%d] = {' % ( symbol, len( FOLD_DISTANCE ) * 2 ) )
+                out.append( emit_array( 'unsigned long long', make_fold( engine, width, poly, reflected ) ) )
+                out.append( '};' )
+                out.append( '' )
+        entries.append( ( key, tables[( normal, reflected )] ) )
+
+    out.append( 'static const struct _hexin_%s_const hexin_%s_const_tables[] = {' % ( engine, engine ) )
+    for ( width, poly, reflected ), symbol in entries:
+        extra = ', %s_fold' % symbol if fold else ''
+        out.append( '    { %2d, %s, %-5s, %s_table%s },' % ( width, literal( ctype, poly ), 'TRUE' if reflected else 'FALSE', symbol, extra ) )
+    out.append( '    {  0, %s, FALSE, NULL%s }' % ( literal( ctype, 0 ), ', NULL' if fold else '' ) )
+    out.append( '};' )
+    out.append( '' )
+    out.append( '#endif //__%s_CONST_H__' % engine.upper() )
+    out.append( '' )
+    return '\n'.join( out )
+
+
+def generate( root ):
+    """ Write src/<engine>/_<engine>const.h, only touching files whose content changed. """
+    for engine in sorted( ENGINES ):
+        text = render( engine, read_catalogue( root, engine ) )
+        name = os.path.join( root, engine, '_%sconst.h' % engine )
+        if os.path.exists( name ) and io.open( name, encoding='utf-8' ).read() == text:
+            continue
+        with io.open( name, 'w', encoding='utf-8' ) as f:
+            f.write( text )
+
+
+if __name__ == '__main__':
+    generate( os.path.dirname( os.path.abspath( sys.argv[0] ) ) )
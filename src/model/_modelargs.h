@@ -0,0 +1,272 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _modelargs.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. METH_FASTCALL argument parsing for the catalogue functions.
+*                       2026-10-17 [Heyn] New add keyword-only arguments, hexin_PyArg_Threads() checks every threads=N.
+*                       2026-10-17 [Heyn] New add hexin_PyArg_Unsigned(), lengths and check values that are range checked rather than masked.
+*
+*   From Python 3.7 the catalogue functions are METH_FASTCALL: the arguments arrive as a C array
+*   plus a tuple of keyword names, no tuple / dict is built and no format string is parsed.
+*   Older versions get the same helpers over the usual args tuple and kws dict.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __MODEL_ARGS_H__
+#define __MODEL_ARGS_H__
+
+#include "_modelcapi.h"
+
+#if PY_VERSION_HEX >= 0x03070000
+#define                 HEXIN_FASTCALL                          1
+#define                 HEXIN_METH_FASTCALL                     METH_FASTCALL|METH_KEYWORDS
+#define                 HEXIN_FASTCALL_PARAMS                   PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames
+#define                 HEXIN_FASTCALL_ARGS                     self, args, nargs, kwnames
+#define                 HEXIN_FASTCALL_UNPACK                   args, nargs, kwnames
+#else
+#define                 HEXIN_METH_FASTCALL                     METH_KEYWORDS|METH_VARARGS
+#define                 HEXIN_FASTCALL_PARAMS                   PyObject *self, PyObject *args, PyObject *kws
+#define                 HEXIN_FASTCALL_ARGS                     self, args, kws
+#define                 HEXIN_FASTCALL_UNPACK                   args, kws
+#endif /* PY_VERSION_HEX */
+
+/*
+ * Borrowed references to the arguments in kwlist order, NULL for the ones not given. An empty
+ * name in kwlist can only be passed by position, the ones after the first positional can only
+ * be passed by keyword and the first required ones must be there. Returns FALSE with TypeError set.
+ */
+#if defined( HEXIN_FASTCALL )
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Unpack( PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+                                                     const char *const *kwlist, Py_ssize_t required, Py_ssize_t positional,
+                                                     PyObject **slots )
+{
+    Py_ssize_t i = 0, j = 0, count = 0;
+    Py_ssize_t nkws = ( kwnames != NULL ) ? PyTuple_GET_SIZE( kwnames ) : 0;
+    PyObject *key = NULL;
+
+    for ( count=0; kwlist[count] != NULL; count++ ) {
+        slots[count] = NULL;
+    }
+
+    if ( nargs > count ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd arguments (%zd given)", count, nargs + nkws );
+        return FALSE;
+    }
+
+    if ( nargs > positional ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd positional arguments (%zd given)", positional, nargs );
+        return FALSE;
+    }
+
+    for ( i=0; i<nargs; i++ ) {
+        slots[i] = args[i];
+    }
+
+    for ( i=0; i<nkws; i++ ) {
+        key = PyTuple_GET_ITEM( kwnames, i );
+        for ( j=0; j<count; j++ ) {
+            if ( ( kwlist[j][0] != '\0' ) && ( PyUnicode_CompareWithASCIIString( key, kwlist[j] ) == 0 ) ) {
+                break;
+            }
+        }
+        if ( j == count ) {
+            PyErr_Format( PyExc_TypeError, "'%U' is an invalid keyword argument for this function", key );
+            return FALSE;
+        }
+        if ( slots[j] != NULL ) {
+            PyErr_Format( PyExc_TypeError, "argument for function given by name ('%s') and position (%zd)", kwlist[j], j + 1 );
+            return FALSE;
+        }
+        slots[j] = args[nargs + i];
+    }
+
+    for ( i=0; i<required; i++ ) {
+        if ( slots[i] == NULL ) {
+            PyErr_Format( PyExc_TypeError, "function missing required argument '%s' (pos %zd)", kwlist[i], i + 1 );
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+#else
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Unpack( PyObject *args, PyObject *kws,
+                                                     const char *const *kwlist, Py_ssize_t required, Py_ssize_t positional,
+                                                     PyObject **slots )
+{
+    Py_ssize_t i = 0, count = 0, found = 0;
+    Py_ssize_t nargs = PyTuple_GET_SIZE( args );
+    Py_ssize_t nkws  = ( kws != NULL ) ? PyDict_Size( kws ) : 0;
+
+    for ( count=0; kwlist[count] != NULL; count++ ) {
+        slots[count] = NULL;
+    }
+
+    if ( nargs > count ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd arguments (%zd given)", count, nargs + nkws );
+        return FALSE;
+    }
+
+    if ( nargs > positional ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd positional arguments (%zd given)", positional, nargs );
+        return FALSE;
+    }
+
+    for ( i=0; i<count; i++ ) {
+        if ( i < nargs ) {
+            slots[i] = PyTuple_GET_ITEM( args, i );
+        }
+        if ( ( nkws == 0 ) || ( kwlist[i][0] == '\0' ) || ( PyDict_GetItemString( kws, kwlist[i] ) == NULL ) ) {
+            continue;
+        }
+        if ( slots[i] != NULL ) {
+            PyErr_Format( PyExc_TypeError, "argument for function given by name ('%s') and position (%zd)", kwlist[i], i + 1 );
+            return FALSE;
+        }
+        slots[i] = PyDict_GetItemString( kws, kwlist[i] );
+        found++;
+    }
+
+    if ( found != nkws ) {
+        PyErr_SetString( PyExc_TypeError, "invalid keyword argument for this function" );
+        return FALSE;
+    }
+
+    for ( i=0; i<required; i++ ) {
+        if ( slots[i] == NULL ) {
+            PyErr_Format( PyExc_TypeError, "function missing required argument '%s' (pos %zd)", kwlist[i], i + 1 );
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+#endif /* HEXIN_FASTCALL */
+
+/*
+ * Same as "y*" ( "s*" on Python 2 ), a contiguous bytes-like object. Returns FALSE with an exception set.
+ * bytes are immutable and held by the caller for the whole call, so they are read in place and
+ * data->obj stays NULL: release with if ( data.obj ) PyBuffer_Release( &data ).
+ */
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Buffer( PyObject *obj, Py_buffer *data )
+{
+    if ( PyBytes_CheckExact( obj ) ) {
+        data->buf = PyBytes_AS_STRING( obj );
+        data->len = PyBytes_GET_SIZE( obj );
+        data->obj = NULL;
+        return TRUE;
+    }
+
+#if PY_MAJOR_VERSION >= 3
+    if ( PyUnicode_Check( obj ) ) {
+        PyErr_Format( PyExc_TypeError, "a bytes-like object is required, not '%.100s'", Py_TYPE( obj )->tp_name );
+        return FALSE;
+    }
+#endif /* PY_MAJOR_VERSION */
+    return ( PyObject_GetBuffer( obj, data, PyBUF_SIMPLE ) == 0 ) ? TRUE : FALSE;
+}
+
+/* Same as "B" / "H" / "I" / "K", the bits that do not fit are dropped. *value is untouched when obj is NULL. */
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Mask( PyObject *obj, unsigned long long *value )
+{
+    unsigned long long mask = 0;
+
+    if ( obj == NULL ) {
+        return TRUE;
+    }
+
+    mask = PyLong_AsUnsignedLongLongMask( obj );
+    if ( ( mask == ( unsigned long long )-1 ) && PyErr_Occurred() ) {
+        return FALSE;
+    }
+    *value = mask;
+    return TRUE;
+}
+
+/*
+ * Same as "K" without the masking, for lengths and check values: ValueError below 0 and OverflowError
+ * from 2**64 up.
+ */
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Unsigned( PyObject *obj, unsigned long long *value )
+{
+    int overflow = 0;
+    PY_LONG_LONG sign = PyLong_AsLongLongAndOverflow( obj, &overflow );
+    unsigned long long result = 0;
+
+    if ( ( sign == -1 ) && PyErr_Occurred() ) {
+        return FALSE;
+    }
+    if ( ( overflow < 0 ) || ( ( overflow == 0 ) && ( sign < 0 ) ) ) {
+        PyErr_SetString( PyExc_ValueError, "value must not be negative" );
+        return FALSE;
+    }
+
+    result = PyLong_AsUnsignedLongLong( obj );
+    if ( ( result == ( unsigned long long )-1 ) && PyErr_Occurred() ) {
+        return FALSE;
+    }
+    *value = result;
+    return TRUE;
+}
+
+/* Same as "$" in the format string, for the args tuple of METH_VARARGS functions. */
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Positional( PyObject *args, Py_ssize_t positional )
+{
+    if ( PyTuple_GET_SIZE( args ) > positional ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd positional arguments (%zd given)",
+                      positional, PyTuple_GET_SIZE( args ) );
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*
+ * The threads keyword. 0 is one thread per CPU, 1 stays in the calling thread and larger counts
+ * are capped at HEXIN_PARALLEL_MAXTHREADS. Negative counts raise ValueError. *threads is untouched
+ * when obj is NULL.
+ */
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Threads( PyObject *obj, unsigned int *threads )
+{
+    int overflow = 0;
+    PY_LONG_LONG value = 0;
+
+    if ( obj == NULL ) {
+        return TRUE;
+    }
+
+    value = PyLong_AsLongLongAndOverflow( obj, &overflow );
+    if ( ( value == -1 ) && PyErr_Occurred() ) {
+        return FALSE;
+    }
+    if ( ( overflow < 0 ) || ( value < 0 ) ) {
+        PyErr_SetString( PyExc_ValueError, "threads must be 0 ( one per CPU ) or more" );
+        return FALSE;
+    }
+
+    *threads = ( ( overflow > 0 ) || ( value > HEXIN_PARALLEL_MAXTHREADS ) ) ? HEXIN_PARALLEL_MAXTHREADS : ( unsigned int )value;
+    return TRUE;
+}
+
+/* Same as "p". *value is untouched when obj is NULL. */
+Py_LOCAL_INLINE( unsigned char ) hexin_PyArg_Bool( PyObject *obj, unsigned int *value )
+{
+    int truth = 0;
+
+    if ( obj == NULL ) {
+        return TRUE;
+    }
+
+    truth = PyObject_IsTrue( obj );
+    if ( truth < 0 ) {
+        return FALSE;
+    }
+    *value = ( unsigned int )truth;
+    return TRUE;
+}
+
+#endif //__MODEL_ARGS_H__
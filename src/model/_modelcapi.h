@@ -0,0 +1,67 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _modelcapi.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. The _model C API the other modules call through.
+*                       2026-10-17 [Heyn] New add parallel_for() and the buffer list helpers for the *_many() functions.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __MODEL_CAPI_H__
+#define __MODEL_CAPI_H__
+
+#define                 HEXIN_MODEL_CAPSULE                     "libscrc._model._C_API"
+
+/* Smallest slice worth its own thread. */
+#define                 HEXIN_PARALLEL_MINSIZE                  0x100000
+#define                 HEXIN_PARALLEL_MAXTHREADS               64
+
+struct _hexin_model_capi {
+    /*
+     * CRC of pSrc split over up to threads threads, called without the GIL. Returns 0 and
+     * leaves *result alone when the buffer is too short to split, the caller computes it.
+     */
+    unsigned int (*parallel)( unsigned int width, unsigned long long poly, unsigned long long init,
+                              unsigned long long xorout, unsigned int refin, unsigned int refout,
+                              const unsigned char *pSrc, unsigned long long len, unsigned int threads,
+                              unsigned long long *result );
+
+    /* Threads worth starting for size bytes of work, threads=0 asks for one per CPU. */
+    unsigned int (*threads)( unsigned long long size, unsigned int threads );
+
+    /* body( ctx, begin, end ) over [0, count) split across threads threads, called without the GIL. */
+    void (*parallel_for)( void (*body)( void *ctx, Py_ssize_t begin, Py_ssize_t end ), void *ctx,
+                          Py_ssize_t count, unsigned int threads );
+
+    /*
+     * Needs the GIL. Every item of the iterable seq as a simple buffer, total is the sum of
+     * their lengths. NULL with an exception set on failure, else free with buffers_release().
+     */
+    Py_buffer *(*buffers_acquire)( PyObject *seq, Py_ssize_t *count, unsigned long long *total );
+    void (*buffers_release)( Py_buffer *buffers, Py_ssize_t count );
+};
+
+#if !defined( HEXIN_MODEL_CAPI_EXPORT )
+/* Needs the GIL. Returns NULL ( no exception set ) when libscrc._model cannot be loaded. */
+static const struct _hexin_model_capi *hexin_model_capi_import( void )
+{
+    static const struct _hexin_model_capi *capi = NULL;
+
+    if ( capi == NULL ) {
+        capi = ( const struct _hexin_model_capi * )PyCapsule_Import( HEXIN_MODEL_CAPSULE, 0 );
+        if ( capi == NULL ) {
+            PyErr_Clear();
+        }
+    }
+    return capi;
+}
+#endif /* HEXIN_MODEL_CAPI_EXPORT */
+
+#endif //__MODEL_CAPI_H__
@@ -0,0 +1,102 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _modelcpuid.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. CPUID / XGETBV and the target attributes shared by the _crcNNsimd.c kernels.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __MODEL_CPUID_H__
+#define __MODEL_CPUID_H__
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define                 HEXIN_X86_SIMD                          1
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#define                 HEXIN_X86_SIMD                          1
+#endif
+
+#if defined( HEXIN_X86_SIMD )
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#define                 HEXIN_TARGET_CLMUL
+#define                 HEXIN_TARGET_SSE42
+#define                 HEXIN_TARGET_AVX2
+#define                 HEXIN_TARGET_SSSE3
+#else
+#include <stddef.h>
+#include <cpuid.h>
+#define                 HEXIN_TARGET_CLMUL                      __attribute__( ( target( "pclmul,ssse3" ) ) )
+#define                 HEXIN_TARGET_SSE42                      __attribute__( ( target( "sse4.2" ) ) )
+#define                 HEXIN_TARGET_AVX2                       __attribute__( ( target( "avx2" ) ) )
+#define                 HEXIN_TARGET_SSSE3                      __attribute__( ( target( "ssse3" ) ) )
+#endif
+
+#define                 HEXIN_CPUID_ECX_SSSE3                   ( 1 << 9  )
+#define                 HEXIN_CPUID_ECX_SSE42                   ( 1 << 20 )
+#define                 HEXIN_CPUID_ECX_PCLMULQDQ               ( 1 << 1  )
+#define                 HEXIN_CPUID_ECX_OSXSAVE                 ( 1 << 27 )
+#define                 HEXIN_CPUID7_EBX_AVX2                   ( 1 << 5  )
+#define                 HEXIN_XCR0_SSE_AVX                      0x06
+
+static __inline unsigned int hexin_cpuid_ecx( void )
+{
+#if defined( _MSC_VER )
+    int regs[4] = { 0 };
+    __cpuid( regs, 1 );
+    return ( unsigned int )regs[2];
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if ( !__get_cpuid( 1, &eax, &ebx, &ecx, &edx ) ) {
+        return 0;
+    }
+    return ecx;
+#endif
+}
+
+static __inline unsigned int hexin_cpuid7_ebx( void )
+{
+#if defined( _MSC_VER )
+    int regs[4] = { 0 };
+    __cpuidex( regs, 7, 0 );
+    return ( unsigned int )regs[1];
+#else
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if ( __get_cpuid_max( 0, NULL ) < 7 ) {
+        return 0;
+    }
+    __cpuid_count( 7, 0, eax, ebx, ecx, edx );
+    return ebx;
+#endif
+}
+
+/* The OS has to save the YMM registers too, not just the CPU support AVX2. */
+static __inline unsigned int hexin_xgetbv0( void )
+{
+#if defined( _MSC_VER )
+    return ( unsigned int )_xgetbv( 0 );
+#else
+    unsigned int eax = 0, edx = 0;
+    __asm__ __volatile__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+    return eax;
+#endif
+}
+
+/* AVX2 in the CPU and the YMM state saved by the OS. */
+static __inline unsigned int hexin_cpuid_avx2( void )
+{
+    return ( ( hexin_cpuid_ecx() & HEXIN_CPUID_ECX_OSXSAVE )
+             && ( ( hexin_xgetbv0() & HEXIN_XCR0_SSE_AVX ) == HEXIN_XCR0_SSE_AVX )
+             && ( hexin_cpuid7_ebx() & HEXIN_CPUID7_EBX_AVX2 ) ) ? 1 : 0;
+}
+
+#endif /* HEXIN_X86_SIMD */
+
+#endif //__MODEL_CPUID_H__
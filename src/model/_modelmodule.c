@@ -0,0 +1,1422 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _modelmodule.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize. libscrc.Model, a compiled CRC model of width 3 to 64.
+*                       2026-10-17 [Heyn] New add Model.new(), hashlib style streaming objects.
+*                       2026-10-17 [Heyn] New add Model.combine().
+*                       2026-10-17 [Heyn] New add threads=N, chunk and combine over worker threads, exported as a capsule.
+*                       2026-10-17 [Heyn] New add Model.extend_zeros().
+*                       2026-10-17 [Heyn] New add Model.many(), the fork-join moved into hexin_parallel_for().
+*                       2026-10-17 [Heyn] New add Multi, several models and Adler-32 fed from one pass over the data.
+*                       2026-10-17 [Heyn] Fix Model() and Hasher.update() on buffers over 4 GB, fed in 1 GB pieces.
+*                       2026-10-17 [Heyn] Fix threads=N, keyword only and checked by hexin_PyArg_Threads(), threads=0 is one per CPU everywhere.
+*                       2026-10-17 [Heyn] Fix combine() / extend_zeros(), negative or 2**64 and larger lengths raise rather than wrap.
+*                       2026-10-17 [Heyn] Fix capi parallel(), models come from a cache and the slices run on a persistent worker pool.
+*
+*********************************************************************************************************
+*/
+
+#include <Python.h>
+#include <structmember.h>
+#include <pythread.h>
+#if defined( _WIN32 )
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "_modeltables.h"
+#define                 HEXIN_MODEL_CAPI_EXPORT                 1
+#include "_modelcapi.h"
+#include "_modelargs.h"
+
+/* Buffers of at least this many bytes are computed with the GIL released. */
+#define                 HEXIN_GIL_THRESHOLD                     8192
+
+/* Multi feeds every algorithm one block at a time, small enough to stay in L1 / L2 between them. */
+#define                 HEXIN_MULTI_BLOCK                       0x8000
+
+/* Models kept for the catalogue functions that call capi parallel(). */
+#define                 HEXIN_MODEL_CACHE_SIZE                  8
+
+#if PY_VERSION_HEX >= 0x03090000
+#define                 HEXIN_MODEL_VECTORCALL                  Py_TPFLAGS_HAVE_VECTORCALL
+#elif PY_VERSION_HEX >= 0x03080000
+#define                 HEXIN_MODEL_VECTORCALL                  _Py_TPFLAGS_HAVE_VECTORCALL
+#endif
+
+static Py_ssize_t hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+
+typedef struct {
+    PyObject_HEAD
+#if defined( HEXIN_MODEL_VECTORCALL )
+    vectorcallfunc vectorcall;
+#endif
+    struct _hexin_model model;
+} hexin_ModelObject;
+
+/* Holds the raw engine register, init went in at new() and xorout / refout only come out in digest(). */
+typedef struct {
+    PyObject_HEAD
+    hexin_ModelObject  *model;
+    unsigned long long  crc;
+    PyThread_type_lock  lock;
+} hexin_HasherObject;
+
+static PyTypeObject hexin_HasherType;
+static PyTypeObject hexin_ModelType;
+static PyTypeObject hexin_MultiType;
+
+/* The lock is only made once a buffer large enough to release the GIL comes in. */
+#define HEXIN_HASHER_ENTER(x)   if ( ( x )->lock ) {                                \
+                                    if ( !PyThread_acquire_lock( ( x )->lock, 0 ) ) { \
+                                        Py_BEGIN_ALLOW_THREADS                      \
+                                        PyThread_acquire_lock( ( x )->lock, 1 );    \
+                                        Py_END_ALLOW_THREADS                        \
+                                    }                                               \
+                                }
+#define HEXIN_HASHER_LEAVE(x)   if ( ( x )->lock ) {                                \
+                                    PyThread_release_lock( ( x )->lock );           \
+                                }
+
+#if defined( PYTHREAD_INVALID_THREAD_ID )
+#define                 HEXIN_THREAD_FAILED(x)                  ( ( x ) == PYTHREAD_INVALID_THREAD_ID )
+#else
+#define                 HEXIN_THREAD_FAILED(x)                  ( ( x ) == -1 )
+#endif
+
+struct _hexin_parallel_task {
+    void                      (*body)( void *ctx, Py_ssize_t begin, Py_ssize_t end );
+    void                       *ctx;
+    Py_ssize_t                  begin;
+    Py_ssize_t                  end;
+    PyThread_type_lock          done;
+};
+
+static void hexin_parallel_task_run( void *arg )
+{
+    struct _hexin_parallel_task *task = ( struct _hexin_parallel_task * )arg;
+
+    task->body( task->ctx, task->begin, task->end );
+    if ( task->done != NULL ) {
+        PyThread_release_lock( task->done );
+    }
+}
+
+static unsigned int hexin_parallel_cpus( void )
+{
+#if defined( _WIN32 )
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    return ( unsigned int )info.dwNumberOfProcessors;
+#elif defined( _SC_NPROCESSORS_ONLN )
+    long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    return ( cpus > 0 ) ? ( unsigned int )cpus : 1;
+#else
+    return 1;
+#endif
+}
+
+/* Threads for size bytes of work: 0 asks for one per CPU, every thread gets at least MINSIZE. */
+static unsigned int hexin_parallel_threads( unsigned long long size, unsigned int threads )
+{
+    if ( threads == 0 ) {
+        threads = hexin_parallel_cpus();
+    }
+    if ( threads > HEXIN_PARALLEL_MAXTHREADS ) {
+        threads = HEXIN_PARALLEL_MAXTHREADS;
+    }
+    if ( size / HEXIN_PARALLEL_MINSIZE < threads ) {
+        threads = ( unsigned int )( size / HEXIN_PARALLEL_MINSIZE );
+    }
+    return ( threads > 1 ) ? threads : 1;
+}
+
+/*
+ * Worker threads kept between parallel_for() calls. A worker sleeps on its wake lock until a
+ * task is handed over and releases done once the task has run. One caller at a time owns the
+ * pool, a concurrent caller or a forked child ( the workers stayed in the parent ) starts its
+ * own threads for that call.
+ */
+struct _hexin_parallel_worker {
+    PyThread_type_lock              wake;
+    PyThread_type_lock              done;
+    struct _hexin_parallel_task    *task;
+};
+
+static struct _hexin_parallel_pool {
+    PyThread_type_lock              lock;
+    long                            pid;
+    unsigned int                    count;
+    struct _hexin_parallel_worker   workers[HEXIN_PARALLEL_MAXTHREADS];
+} hexin_parallel_pool;
+
+static long hexin_parallel_pid( void )
+{
+#if defined( _WIN32 )
+    return 0;
+#else
+    return ( long )getpid();
+#endif
+}
+
+static void hexin_parallel_worker_run( void *arg )
+{
+    struct _hexin_parallel_worker *worker = ( struct _hexin_parallel_worker * )arg;
+
+    for ( ;; ) {
+        PyThread_acquire_lock( worker->wake, 1 );
+        worker->task->body( worker->task->ctx, worker->task->begin, worker->task->end );
+        PyThread_release_lock( worker->done );
+    }
+}
+
+/* Needs the pool lock. Starts workers up to count, returns how many there are. */
+static unsigned int hexin_parallel_pool_grow( unsigned int count )
+{
+    struct _hexin_parallel_worker *worker = NULL;
+
+    while ( hexin_parallel_pool.count < count ) {
+        worker = &hexin_parallel_pool.workers[hexin_parallel_pool.count];
+        worker->wake = PyThread_allocate_lock();
+        worker->done = PyThread_allocate_lock();
+        if ( ( worker->wake != NULL ) && ( worker->done != NULL ) ) {
+            PyThread_acquire_lock( worker->wake, 1 );
+            PyThread_acquire_lock( worker->done, 1 );
+            if ( !HEXIN_THREAD_FAILED( PyThread_start_new_thread( hexin_parallel_worker_run, worker ) ) ) {
+                hexin_parallel_pool.count++;
+                continue;
+            }
+        }
+        if ( worker->wake != NULL ) {
+            PyThread_free_lock( worker->wake );
+        }
+        if ( worker->done != NULL ) {
+            PyThread_free_lock( worker->done );
+        }
+        break;
+    }
+    return hexin_parallel_pool.count;
+}
+
+/* Needs the GIL, called once from the module init. Without the lock every call starts its own threads. */
+static void hexin_parallel_pool_init( void )
+{
+    hexin_parallel_pool.lock = PyThread_allocate_lock();
+    hexin_parallel_pool.pid  = hexin_parallel_pid();
+}
+
+/*
+ * body( ctx, begin, end ) over [0, count) in threads even ranges, called without the GIL.
+ * The first range runs here, the others go to the pool workers. When the pool is busy the
+ * ranges get threads of their own, a thread that fails to start runs its range inline.
+ */
+static void hexin_parallel_for( void (*body)( void *ctx, Py_ssize_t begin, Py_ssize_t end ), void *ctx,
+                                Py_ssize_t count, unsigned int threads )
+{
+    struct _hexin_parallel_task tasks[HEXIN_PARALLEL_MAXTHREADS];
+    struct _hexin_parallel_worker *worker = NULL;
+    unsigned int workers = 0;
+    unsigned int pooled  = FALSE;
+    unsigned int i = 0;
+
+    if ( threads > HEXIN_PARALLEL_MAXTHREADS ) {
+        threads = HEXIN_PARALLEL_MAXTHREADS;
+    }
+    if ( ( Py_ssize_t )threads > count ) {
+        threads = ( unsigned int )count;
+    }
+    if ( threads <= 1 ) {
+        if ( count > 0 ) {
+            body( ctx, 0, count );
+        }
+        return;
+    }
+
+    if ( ( hexin_parallel_pool.lock != NULL ) && ( hexin_parallel_pool.pid == hexin_parallel_pid() )
+                                              && PyThread_acquire_lock( hexin_parallel_pool.lock, 0 ) ) {
+        pooled  = TRUE;
+        workers = hexin_parallel_pool_grow( threads - 1 );
+    }
+
+    for ( i=1; i<threads; i++ ) {
+        tasks[i].body  = body;
+        tasks[i].ctx   = ctx;
+        tasks[i].begin = ( Py_ssize_t )( ( unsigned long long )count * i / threads );
+        tasks[i].end   = ( Py_ssize_t )( ( unsigned long long )count * ( i + 1 ) / threads );
+        tasks[i].done  = NULL;
+        if ( i <= workers ) {
+            worker = &hexin_parallel_pool.workers[i - 1];
+            worker->task = &tasks[i];
+            PyThread_release_lock( worker->wake );
+            continue;
+        }
+        tasks[i].done  = PyThread_allocate_lock();
+        if ( tasks[i].done == NULL ) {
+            hexin_parallel_task_run( &tasks[i] );
+            continue;
+        }
+        PyThread_acquire_lock( tasks[i].done, 1 );
+        if ( HEXIN_THREAD_FAILED( PyThread_start_new_thread( hexin_parallel_task_run, &tasks[i] ) ) ) {
+            hexin_parallel_task_run( &tasks[i] );
+        }
+    }
+
+    body( ctx, 0, ( Py_ssize_t )( ( unsigned long long )count / threads ) );
+
+    for ( i=1; i<threads; i++ ) {
+        if ( i <= workers ) {
+            PyThread_acquire_lock( hexin_parallel_pool.workers[i - 1].done, 1 );
+        } else if ( tasks[i].done != NULL ) {
+            PyThread_acquire_lock( tasks[i].done, 1 );
+            PyThread_free_lock( tasks[i].done );
+        }
+    }
+
+    if ( pooled ) {
+        PyThread_release_lock( hexin_parallel_pool.lock );
+    }
+}
+
+struct _hexin_model_slices {
+    const struct _hexin_model  *model;
+    const unsigned char        *pSrc;
+    unsigned long long          len;
+    unsigned long long          size;
+    unsigned long long          crc[HEXIN_PARALLEL_MAXTHREADS];
+};
+
+static void hexin_model_slices_run( void *arg, Py_ssize_t begin, Py_ssize_t end )
+{
+    struct _hexin_model_slices *slices = ( struct _hexin_model_slices * )arg;
+    unsigned long long last = slices->len / slices->size - 1;
+    Py_ssize_t i = 0;
+
+    for ( i=begin; i<end; i++ ) {
+        slices->crc[i] = hexin_model_update_long( ( i == 0 ) ? slices->crc[0] : 0, slices->pSrc + i * slices->size,
+                                                  ( ( unsigned long long )i == last ) ? ( slices->len - i * slices->size ) : slices->size,
+                                                  slices->model );
+    }
+}
+
+/*
+ * Raw register after pSrc, called without the GIL. The first slice runs from crc, the others
+ * start from a zero register on their own threads and are merged in order:
+ * crc = shift( crc, len ) ^ slice.
+ */
+static unsigned long long hexin_model_update_parallel( unsigned long long crc, const unsigned char *pSrc, unsigned long long len,
+                                                       unsigned int threads, const struct _hexin_model *model )
+{
+    struct _hexin_model_slices slices;
+    unsigned int i = 0;
+
+    threads = hexin_parallel_threads( len, threads );
+    if ( threads <= 1 ) {
+        return hexin_model_update_long( crc, pSrc, len, model );
+    }
+
+    slices.model  = model;
+    slices.pSrc   = pSrc;
+    slices.len    = len;
+    slices.size   = len / threads;
+    slices.crc[0] = crc;
+    hexin_parallel_for( hexin_model_slices_run, &slices, threads, threads );
+
+    crc = slices.crc[0];
+    for ( i=1; i<threads; i++ ) {
+        crc = hexin_model_shift( crc, ( i == threads - 1 ) ? ( len - i * slices.size ) : slices.size, model ) ^ slices.crc[i];
+    }
+    return crc;
+}
+
+/* Needs the GIL, every item of seq as a simple buffer. NULL with an exception set on failure. */
+static Py_buffer * hexin_buffers_acquire( PyObject *seq, Py_ssize_t *count, unsigned long long *total )
+{
+    PyObject  *fast = PySequence_Fast( seq, "expected an iterable of bytes-like objects" );
+    Py_buffer *buffers = NULL;
+    Py_ssize_t i = 0;
+
+    if ( fast == NULL ) {
+        return NULL;
+    }
+
+    *count = PySequence_Fast_GET_SIZE( fast );
+    *total = 0;
+    buffers = PyMem_New( Py_buffer, ( *count > 0 ) ? *count : 1 );
+    if ( buffers == NULL ) {
+        Py_DECREF( fast );
+        return ( Py_buffer * )PyErr_NoMemory();
+    }
+
+    for ( i=0; i<*count; i++ ) {
+        if ( PyObject_GetBuffer( PySequence_Fast_GET_ITEM( fast, i ), &buffers[i], PyBUF_SIMPLE ) < 0 ) {
+            while ( i-- ) {
+                PyBuffer_Release( &buffers[i] );
+            }
+            PyMem_Free( buffers );
+            Py_DECREF( fast );
+            return NULL;
+        }
+        *total += ( unsigned long long )buffers[i].len;
+    }
+
+    Py_DECREF( fast );
+    return buffers;
+}
+
+static void hexin_buffers_release( Py_buffer *buffers, Py_ssize_t count )
+{
+    Py_ssize_t i = 0;
+
+    for ( i=0; i<count; i++ ) {
+        PyBuffer_Release( &buffers[i] );
+    }
+    PyMem_Free( buffers );
+}
+
+/*
+ * Models built for capi parallel(), keyed by every parameter, least recently used entry is
+ * replaced. parallel() runs without the GIL so lookups take the cache lock, an entry in use
+ * is never replaced.
+ */
+static struct _hexin_model_cache {
+    unsigned int        valid;
+    unsigned int        refs;
+    unsigned long long  used;
+    struct _hexin_model  model;
+} hexin_model_cache[HEXIN_MODEL_CACHE_SIZE];
+
+static unsigned long long hexin_model_cache_tick = 0;
+static PyThread_type_lock hexin_model_cache_lock = NULL;
+
+/* NULL when the lock is missing or every entry is in use, else release it with hexin_model_cache_release(). */
+static struct _hexin_model_cache * hexin_model_cache_acquire( unsigned int width, unsigned long long poly, unsigned long long init,
+                                                              unsigned long long xorout, unsigned int refin, unsigned int refout )
+{
+    struct _hexin_model_cache *slot  = NULL;
+    struct _hexin_model_cache *entry = NULL;
+    unsigned int i = 0;
+
+    if ( hexin_model_cache_lock == NULL ) {
+        return NULL;
+    }
+    PyThread_acquire_lock( hexin_model_cache_lock, 1 );
+
+    for ( i=0; i<HEXIN_MODEL_CACHE_SIZE; i++ ) {
+        entry = &hexin_model_cache[i];
+        if ( entry->valid && ( entry->model.width  == width  ) && ( entry->model.poly   == poly   )
+                          && ( entry->model.init   == init   ) && ( entry->model.xorout == xorout )
+                          && ( entry->model.refin  == refin  ) && ( entry->model.refout == refout ) ) {
+            slot = entry;
+            break;
+        }
+    }
+
+    if ( slot == NULL ) {
+        for ( i=0; i<HEXIN_MODEL_CACHE_SIZE; i++ ) {
+            entry = &hexin_model_cache[i];
+            if ( entry->refs != 0 ) {
+                continue;
+            }
+            if ( !entry->valid ) {
+                slot = entry;
+                break;
+            }
+            if ( ( slot == NULL ) || ( entry->used < slot->used ) ) {
+                slot = entry;
+            }
+        }
+
+        if ( slot != NULL ) {
+            slot->model.width  = width;
+            slot->model.poly   = poly;
+            slot->model.init   = init;
+            slot->model.xorout = xorout;
+            slot->model.refin  = refin;
+            slot->model.refout = refout;
+            slot->valid = hexin_model_init( &slot->model );
+            if ( !slot->valid ) {
+                slot = NULL;
+            }
+        }
+    }
+
+    if ( slot != NULL ) {
+        slot->used = ++hexin_model_cache_tick;
+        slot->refs++;
+    }
+    PyThread_release_lock( hexin_model_cache_lock );
+    return slot;
+}
+
+static void hexin_model_cache_release( struct _hexin_model_cache *entry )
+{
+    PyThread_acquire_lock( hexin_model_cache_lock, 1 );
+    entry->refs--;
+    PyThread_release_lock( hexin_model_cache_lock );
+}
+
+static unsigned int hexin_model_capi_parallel( unsigned int width, unsigned long long poly, unsigned long long init,
+                                               unsigned long long xorout, unsigned int refin, unsigned int refout,
+                                               const unsigned char *pSrc, unsigned long long len, unsigned int threads,
+                                               unsigned long long *result )
+{
+    struct _hexin_model_cache *entry = NULL;
+    struct _hexin_model *model = NULL;
+
+    if ( hexin_parallel_threads( len, threads ) <= 1 ) {
+        return FALSE;
+    }
+
+    entry = hexin_model_cache_acquire( width, poly, init, xorout, refin, refout );
+    if ( entry != NULL ) {
+        model = &entry->model;
+    } else {
+        model = ( struct _hexin_model * )malloc( sizeof( struct _hexin_model ) );
+        if ( model == NULL ) {
+            return FALSE;
+        }
+        model->width  = width;
+        model->poly   = poly;
+        model->init   = init;
+        model->xorout = xorout;
+        model->refin  = refin;
+        model->refout = refout;
+        hexin_model_init( model );
+    }
+
+    *result = hexin_model_final( hexin_model_update_parallel( hexin_model_start( model ), pSrc, len, threads, model ), model );
+
+    if ( entry != NULL ) {
+        hexin_model_cache_release( entry );
+    } else {
+        free( model );
+    }
+    return TRUE;
+}
+
+static const struct _hexin_model_capi hexin_model_capi = {
+    .parallel        = hexin_model_capi_parallel,
+    .threads         = hexin_parallel_threads,
+    .parallel_for    = hexin_parallel_for,
+    .buffers_acquire = hexin_buffers_acquire,
+    .buffers_release = hexin_buffers_release,
+};
+
+static PyObject * hexin_model_calc( hexin_ModelObject *self, PyObject *obj, unsigned int threads )
+{
+    Py_buffer data = { NULL, NULL };
+    unsigned long long result = 0;
+
+    if ( PyObject_GetBuffer( obj, &data, PyBUF_SIMPLE ) < 0 ) {
+        return NULL;
+    }
+
+    if ( ( threads != 1 ) || ( data.len >= hexin_gil_threshold ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_model_update_parallel( hexin_model_start( &self->model ), (const unsigned char *)data.buf,
+                                              (unsigned long long)data.len, threads, &self->model );
+        result = hexin_model_final( result, &self->model );
+        Py_END_ALLOW_THREADS
+    } else {
+        result = hexin_model_update_long( hexin_model_start( &self->model ), (const unsigned char *)data.buf,
+                                          (unsigned long long)data.len, &self->model );
+        result = hexin_model_final( result, &self->model );
+    }
+
+    PyBuffer_Release( &data );
+
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+#if defined( HEXIN_MODEL_VECTORCALL )
+static PyObject * hexin_model_vectorcall( PyObject *self, PyObject *const *args, size_t nargsf, PyObject *kwnames )
+{
+    Py_ssize_t nargs = PyVectorcall_NARGS( nargsf );
+    Py_ssize_t nkws  = ( kwnames != NULL ) ? PyTuple_GET_SIZE( kwnames ) : 0;
+    unsigned int threads = 1;
+
+    if ( ( nkws > 1 ) || ( ( nkws == 1 ) && ( PyUnicode_CompareWithASCIIString( PyTuple_GET_ITEM( kwnames, 0 ), "threads" ) != 0 ) ) ) {
+        PyErr_SetString( PyExc_TypeError, "Model() takes only the threads keyword argument" );
+        return NULL;
+    }
+
+    if ( nargs != 1 ) {
+        PyErr_Format( PyExc_TypeError, "Model() takes data and an optional threads keyword (%zd given)", nargs + nkws );
+        return NULL;
+    }
+
+    if ( ( nkws == 1 ) && !hexin_PyArg_Threads( args[1], &threads ) ) {
+        return NULL;
+    }
+
+    return hexin_model_calc( ( hexin_ModelObject * )self, args[0], threads );
+}
+#else
+static PyObject * hexin_model_call( PyObject *self, PyObject *args, PyObject *kws )
+{
+    PyObject *obj = NULL, *pthreads = NULL;
+    unsigned int threads = 1;
+
+    static char* kwlist[]={ "data", "threads", NULL };
+
+    if ( !hexin_PyArg_Positional( args, 1 ) || !PyArg_ParseTupleAndKeywords( args, kws, "O|O", kwlist, &obj, &pthreads )
+      || !hexin_PyArg_Threads( pthreads, &threads ) ) {
+        return NULL;
+    }
+
+    return hexin_model_calc( ( hexin_ModelObject * )self, obj, threads );
+}
+#endif /* HEXIN_MODEL_VECTORCALL */
+
+static PyObject * hexin_model_new( PyTypeObject *type, PyObject *args, PyObject *kws )
+{
+    hexin_ModelObject *self = NULL;
+    struct _hexin_model model = { .width  = 0,
+                                  .poly   = 0,
+                                  .init   = 0,
+                                  .xorout = 0,
+                                  .refin  = FALSE,
+                                  .refout = FALSE };
+    unsigned long long mask = 0;
+
+    static char* kwlist[]={ "width", "poly", "init", "xorout", "refin", "refout", NULL };
+
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "IK|KKpp", kwlist, &model.width,
+                                                                     &model.poly,
+                                                                     &model.init,
+                                                                     &model.xorout,
+                                                                     &model.refin,
+                                                                     &model.refout ) ) {
+        return NULL;
+    }
+
+    if ( ( model.width < HEXIN_MODEL_WIDTH_MIN ) || ( model.width > HEXIN_MODEL_WIDTH_MAX ) ) {
+        PyErr_Format( PyExc_ValueError, "width must be in %d..%d", HEXIN_MODEL_WIDTH_MIN, HEXIN_MODEL_WIDTH_MAX );
+        return NULL;
+    }
+
+    mask = HEXIN_MODEL_MASK( model.width );
+    if ( ( model.poly & ~mask ) || ( model.init & ~mask ) || ( model.xorout & ~mask ) ) {
+        PyErr_Format( PyExc_ValueError, "poly, init and xorout must fit in %u bits", model.width );
+        return NULL;
+    }
+
+    self = ( hexin_ModelObject * )type->tp_alloc( type, 0 );
+    if ( self == NULL ) {
+        return NULL;
+    }
+
+    self->model = model;
+    hexin_model_init( &self->model );
+#if defined( HEXIN_MODEL_VECTORCALL )
+    self->vectorcall = hexin_model_vectorcall;
+#endif
+
+    return ( PyObject * )self;
+}
+
+static PyObject * hexin_model_repr( hexin_ModelObject *self )
+{
+    char buffer[160];
+    unsigned int digits = ( self->model.width + 3 ) / 4;
+
+    PyOS_snprintf( buffer, sizeof( buffer ), "Model(width=%u, poly=0x%0*llX, init=0x%0*llX, xorout=0x%0*llX, refin=%s, refout=%s)",
+                   self->model.width,
+                   digits, self->model.poly,
+                   digits, self->model.init,
+                   digits, self->model.xorout,
+                   self->model.refin  ? "True" : "False",
+                   self->model.refout ? "True" : "False" );
+
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_FromString( buffer );
+#else
+    return PyString_FromString( buffer );
+#endif /* PY_MAJOR_VERSION */
+}
+
+static PyObject * hexin_hasher_update_buffer( hexin_HasherObject *self, PyObject *obj )
+{
+    Py_buffer data = { NULL, NULL };
+
+    if ( PyObject_GetBuffer( obj, &data, PyBUF_SIMPLE ) < 0 ) {
+        return NULL;
+    }
+
+    if ( ( self->lock == NULL ) && ( data.len >= hexin_gil_threshold ) ) {
+        self->lock = PyThread_allocate_lock();
+    }
+
+    if ( ( self->lock != NULL ) && ( data.len >= hexin_gil_threshold ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock( self->lock, 1 );
+        self->crc = hexin_model_update_long( self->crc, (const unsigned char *)data.buf, (unsigned long long)data.len, &self->model->model );
+        PyThread_release_lock( self->lock );
+        Py_END_ALLOW_THREADS
+    } else {
+        HEXIN_HASHER_ENTER( self );
+        self->crc = hexin_model_update_long( self->crc, (const unsigned char *)data.buf, (unsigned long long)data.len, &self->model->model );
+        HEXIN_HASHER_LEAVE( self );
+    }
+
+    PyBuffer_Release( &data );
+
+    Py_RETURN_NONE;
+}
+
+static PyObject * hexin_hasher_update( hexin_HasherObject *self, PyObject *args )
+{
+    PyObject *obj = NULL;
+
+    if ( !PyArg_ParseTuple( args, "O:update", &obj ) ) {
+        return NULL;
+    }
+
+    return hexin_hasher_update_buffer( self, obj );
+}
+
+static unsigned long long hexin_hasher_value( hexin_HasherObject *self )
+{
+    unsigned long long crc = 0;
+
+    HEXIN_HASHER_ENTER( self );
+    crc = self->crc;
+    HEXIN_HASHER_LEAVE( self );
+
+    return hexin_model_final( crc, &self->model->model );
+}
+
+static PyObject * hexin_hasher_intdigest( hexin_HasherObject *self, PyObject *args )
+{
+    return PyLong_FromUnsignedLongLong( hexin_hasher_value( self ) );
+}
+
+static PyObject * hexin_hasher_digest( hexin_HasherObject *self, PyObject *args )
+{
+    unsigned char digest[8];
+    unsigned int  i = 0, size = ( self->model->model.width + 7 ) / 8;
+    unsigned long long crc = hexin_hasher_value( self );
+
+    /* Big-endian, the way the CRC is printed. */
+    for ( i=0; i<size; i++ ) {
+        digest[size - 1 - i] = ( unsigned char )( crc >> ( 8 * i ) );
+    }
+
+    return PyBytes_FromStringAndSize( ( const char * )digest, size );
+}
+
+static PyObject * hexin_hasher_hexdigest( hexin_HasherObject *self, PyObject *args )
+{
+    char buffer[17];
+    unsigned int size = ( self->model->model.width + 7 ) / 8;
+
+    PyOS_snprintf( buffer, sizeof( buffer ), "%0*llx", size * 2, hexin_hasher_value( self ) );
+
+#if PY_MAJOR_VERSION >= 3
+    return PyUnicode_FromString( buffer );
+#else
+    return PyString_FromString( buffer );
+#endif /* PY_MAJOR_VERSION */
+}
+
+static PyObject * hexin_hasher_copy( hexin_HasherObject *self, PyObject *args )
+{
+    hexin_HasherObject *copy = PyObject_New( hexin_HasherObject, &hexin_HasherType );
+
+    if ( copy == NULL ) {
+        return NULL;
+    }
+
+    Py_INCREF( self->model );
+    copy->model = self->model;
+    copy->lock  = NULL;
+
+    HEXIN_HASHER_ENTER( self );
+    copy->crc = self->crc;
+    HEXIN_HASHER_LEAVE( self );
+
+    return ( PyObject * )copy;
+}
+
+static void hexin_hasher_dealloc( hexin_HasherObject *self )
+{
+    if ( self->lock != NULL ) {
+        PyThread_free_lock( self->lock );
+    }
+    Py_XDECREF( self->model );
+    PyObject_Del( self );
+}
+
+static PyObject * hexin_hasher_get_digest_size( hexin_HasherObject *self, void *closure )
+{
+    return PyLong_FromLong( ( self->model->model.width + 7 ) / 8 );
+}
+
+static PyMethodDef hexin_hasher_methods[] = {
+    { "update",     (PyCFunction)hexin_hasher_update,    METH_VARARGS, "Feed a bytes-like object" },
+    { "digest",     (PyCFunction)hexin_hasher_digest,    METH_NOARGS,  "CRC of the data so far as big-endian bytes" },
+    { "hexdigest",  (PyCFunction)hexin_hasher_hexdigest, METH_NOARGS,  "CRC of the data so far as a hex string" },
+    { "intdigest",  (PyCFunction)hexin_hasher_intdigest, METH_NOARGS,  "CRC of the data so far as an integer" },
+    { "copy",       (PyCFunction)hexin_hasher_copy,      METH_NOARGS,  "Copy of the current state" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyMemberDef hexin_hasher_members[] = {
+    { "model",  T_OBJECT, offsetof( hexin_HasherObject, model ), READONLY, "The Model being computed" },
+    { NULL }        /* Sentinel */
+};
+
+static PyGetSetDef hexin_hasher_getset[] = {
+    { "digest_size", ( getter )hexin_hasher_get_digest_size, NULL, "Size of digest() in bytes", NULL },
+    { NULL }        /* Sentinel */
+};
+
+static PyTypeObject hexin_HasherType = {
+    PyVarObject_HEAD_INIT( NULL, 0 )
+    .tp_name        = "libscrc.Hasher",
+    .tp_basicsize   = sizeof( hexin_HasherObject ),
+    .tp_dealloc     = ( destructor )hexin_hasher_dealloc,
+    .tp_flags       = Py_TPFLAGS_DEFAULT,
+    .tp_doc         = "Streaming CRC, made by Model.new() or libscrc.new()",
+    .tp_methods     = hexin_hasher_methods,
+    .tp_members     = hexin_hasher_members,
+    .tp_getset      = hexin_hasher_getset,
+};
+
+static PyObject * hexin_model_new_hasher( hexin_ModelObject *self, PyObject *args, PyObject *kws )
+{
+    PyObject *data = NULL;
+    hexin_HasherObject *hasher = NULL;
+
+    static char* kwlist[]={ "data", NULL };
+
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "|O:new", kwlist, &data ) ) {
+        return NULL;
+    }
+
+    hasher = PyObject_New( hexin_HasherObject, &hexin_HasherType );
+    if ( hasher == NULL ) {
+        return NULL;
+    }
+
+    Py_INCREF( self );
+    hasher->model = self;
+    hasher->crc   = hexin_model_start( &self->model );
+    hasher->lock  = NULL;
+
+    if ( ( data != NULL ) && ( data != Py_None ) ) {
+        PyObject *ret = hexin_hasher_update_buffer( hasher, data );
+        if ( ret == NULL ) {
+            Py_DECREF( hasher );
+            return NULL;
+        }
+        Py_DECREF( ret );
+    }
+
+    return ( PyObject * )hasher;
+}
+
+static PyObject * hexin_model_get_refin( hexin_ModelObject *self, void *closure )
+{
+    return PyBool_FromLong( self->model.refin );
+}
+
+static PyObject * hexin_model_get_refout( hexin_ModelObject *self, void *closure )
+{
+    return PyBool_FromLong( self->model.refout );
+}
+
+static PyObject * hexin_model_combine_crc( hexin_ModelObject *self, PyObject *args )
+{
+    PyObject *pcrc1 = NULL, *pcrc2 = NULL, *plen2 = NULL;
+    unsigned long long crc1 = 0, crc2 = 0, len2 = 0;
+    unsigned long long mask = HEXIN_MODEL_MASK( self->model.width );
+
+    if ( !PyArg_ParseTuple( args, "OOO:combine", &pcrc1, &pcrc2, &plen2 )
+      || !hexin_PyArg_Unsigned( pcrc1, &crc1 ) || !hexin_PyArg_Unsigned( pcrc2, &crc2 ) || !hexin_PyArg_Unsigned( plen2, &len2 ) ) {
+        return NULL;
+    }
+
+    if ( ( crc1 & ~mask ) || ( crc2 & ~mask ) ) {
+        PyErr_Format( PyExc_ValueError, "crc must fit in %u bits", self->model.width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_model_combine( crc1, crc2, len2, &self->model ) );
+}
+
+static PyObject * hexin_model_extend_zeros( hexin_ModelObject *self, PyObject *args )
+{
+    PyObject *pcrc = NULL, *pn = NULL;
+    unsigned long long crc = 0, n = 0;
+
+    if ( !PyArg_ParseTuple( args, "OO:extend_zeros", &pcrc, &pn )
+      || !hexin_PyArg_Unsigned( pcrc, &crc ) || !hexin_PyArg_Unsigned( pn, &n ) ) {
+        return NULL;
+    }
+
+    if ( crc & ~HEXIN_MODEL_MASK( self->model.width ) ) {
+        PyErr_Format( PyExc_ValueError, "crc must fit in %u bits", self->model.width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_model_extend( crc, n, &self->model ) );
+}
+
+struct _hexin_model_many {
+    const struct _hexin_model  *model;
+    const Py_buffer            *buffers;
+    unsigned long long         *values;
+};
+
+static void hexin_model_many_run( void *arg, Py_ssize_t begin, Py_ssize_t end )
+{
+    struct _hexin_model_many *many = ( struct _hexin_model_many * )arg;
+    Py_ssize_t i = 0;
+
+    for ( i=begin; i<end; i++ ) {
+        many->values[i] = hexin_model_final( hexin_model_update_long( hexin_model_start( many->model ),
+                                                                      (const unsigned char *)many->buffers[i].buf,
+                                                                      (unsigned long long)many->buffers[i].len, many->model ),
+                                             many->model );
+    }
+}
+
+/* The smallest array typecode that holds width bits. */
+static const char * hexin_model_typecode( unsigned int width )
+{
+    return ( width <= 8 ) ? "B" : ( width <= 16 ) ? "H" : ( width <= 32 ) ? "I" : "Q";
+}
+
+static PyObject * hexin_model_many( hexin_ModelObject *self, PyObject *args, PyObject *kws )
+{
+    PyObject *seq = NULL, *pthreads = NULL, *values = NULL, *array = NULL, *result = NULL;
+    Py_buffer *buffers = NULL;
+    Py_ssize_t count = 0, i = 0;
+    unsigned long long total = 0;
+    unsigned int threads = 0;
+    const char *typecode = hexin_model_typecode( self->model.width );
+    unsigned char *pDst = NULL;
+    struct _hexin_model_many many;
+
+    static char* kwlist[]={ "buffers", "threads", NULL };
+
+    if ( !hexin_PyArg_Positional( args, 1 ) || !PyArg_ParseTupleAndKeywords( args, kws, "O|O:many", kwlist, &seq, &pthreads )
+      || !hexin_PyArg_Threads( pthreads, &threads ) ) {
+        return NULL;
+    }
+
+    buffers = hexin_buffers_acquire( seq, &count, &total );
+    if ( buffers == NULL ) {
+        return NULL;
+    }
+
+    many.model   = &self->model;
+    many.buffers = buffers;
+    many.values  = PyMem_New( unsigned long long, ( count > 0 ) ? count : 1 );
+    if ( many.values == NULL ) {
+        hexin_buffers_release( buffers, count );
+        return PyErr_NoMemory();
+    }
+
+    if ( total >= ( unsigned long long )hexin_gil_threshold ) {
+        Py_BEGIN_ALLOW_THREADS
+        hexin_parallel_for( hexin_model_many_run, &many, count, hexin_parallel_threads( total, threads ) );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_model_many_run( &many, 0, count );
+    }
+    hexin_buffers_release( buffers, count );
+
+    /* Packed in the array's native item size. */
+    values = PyBytes_FromStringAndSize( NULL, count * ( Py_ssize_t )( ( typecode[0] == 'B' ) ? sizeof( unsigned char )  :
+                                                                      ( typecode[0] == 'H' ) ? sizeof( unsigned short ) :
+                                                                      ( typecode[0] == 'I' ) ? sizeof( unsigned int )   :
+                                                                                               sizeof( unsigned long long ) ) );
+    if ( values != NULL ) {
+        pDst = ( unsigned char * )PyBytes_AS_STRING( values );
+        for ( i=0; i<count; i++ ) {
+            switch ( typecode[0] ) {
+                case 'B': ( ( unsigned char      * )pDst )[i] = ( unsigned char  )many.values[i]; break;
+                case 'H': ( ( unsigned short     * )pDst )[i] = ( unsigned short )many.values[i]; break;
+                case 'I': ( ( unsigned int       * )pDst )[i] = ( unsigned int   )many.values[i]; break;
+                default : ( ( unsigned long long * )pDst )[i] = many.values[i];                  break;
+            }
+        }
+    }
+    PyMem_Free( many.values );
+
+    if ( values == NULL ) {
+        return NULL;
+    }
+
+    array = PyImport_ImportModule( "array" );
+    if ( array != NULL ) {
+        result = PyObject_CallMethod( array, "array", "sO", typecode, values );
+        Py_DECREF( array );
+    }
+    Py_DECREF( values );
+
+    return result;
+}
+
+static PyMethodDef hexin_model_methods[] = {
+    { "new",        (PyCFunction)hexin_model_new_hasher, METH_VARARGS|METH_KEYWORDS, "new(data=None) -> Hasher, a streaming CRC of this model" },
+    { "combine",    (PyCFunction)hexin_model_combine_crc, METH_VARARGS, "combine(crc_a, crc_b, len_b) -> CRC of a+b, in O(log len_b)" },
+    { "extend_zeros", (PyCFunction)hexin_model_extend_zeros, METH_VARARGS, "extend_zeros(crc, n) -> CRC of the same data followed by n zero bytes, in O(log n)" },
+    { "many",       (PyCFunction)hexin_model_many, METH_VARARGS|METH_KEYWORDS, "many(buffers, threads=0) -> array of the CRC of every buffer, large lists are split over threads" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyMemberDef hexin_model_members[] = {
+    { "width",  T_UINT,      offsetof( hexin_ModelObject, model.width  ), READONLY, "Width in bits" },
+    { "poly",   T_ULONGLONG, offsetof( hexin_ModelObject, model.poly   ), READONLY, "Polynomial, MSB-first without the top bit" },
+    { "init",   T_ULONGLONG, offsetof( hexin_ModelObject, model.init   ), READONLY, "Initial register" },
+    { "xorout", T_ULONGLONG, offsetof( hexin_ModelObject, model.xorout ), READONLY, "Final xor value" },
+    { NULL }        /* Sentinel */
+};
+
+static PyGetSetDef hexin_model_getset[] = {
+    { "refin",  ( getter )hexin_model_get_refin,  NULL, "Reflect input bytes",  NULL },
+    { "refout", ( getter )hexin_model_get_refout, NULL, "Reflect the result",   NULL },
+    { NULL }        /* Sentinel */
+};
+
+PyDoc_STRVAR( hexin_model_doc,
+"Model(width, poly, init=0, xorout=0, refin=False, refout=False)\n"
+"\n"
+"Compiled CRC model of width 3 to 64, the tables are built once.\n"
+"Call it on a bytes-like object to get the CRC, e.g. Model(16, 0x8005, 0xFFFF, 0, True, True)(b'123456789').\n"
+"model(data, threads=N) splits buffers of a few MB and more over N threads, threads=0 is one per CPU.\n" );
+
+static PyTypeObject hexin_ModelType = {
+    PyVarObject_HEAD_INIT( NULL, 0 )
+    .tp_name        = "libscrc.Model",
+    .tp_basicsize   = sizeof( hexin_ModelObject ),
+    .tp_dealloc     = ( destructor )PyObject_Del,
+    .tp_repr        = ( reprfunc )hexin_model_repr,
+#if defined( HEXIN_MODEL_VECTORCALL )
+    .tp_vectorcall_offset = offsetof( hexin_ModelObject, vectorcall ),
+    .tp_call        = PyVectorcall_Call,
+    .tp_flags       = Py_TPFLAGS_DEFAULT | HEXIN_MODEL_VECTORCALL,
+#else
+    .tp_call        = hexin_model_call,
+    .tp_flags       = Py_TPFLAGS_DEFAULT,
+#endif
+    .tp_doc         = hexin_model_doc,
+    .tp_methods     = hexin_model_methods,
+    .tp_members     = hexin_model_members,
+    .tp_getset      = hexin_model_getset,
+    .tp_new         = hexin_model_new,
+};
+
+/* One algorithm of a Multi, a Model register or, with model NULL, the Adler-32 sums. */
+struct _hexin_multi_entry {
+    hexin_ModelObject  *model;
+    unsigned long long  crc;
+};
+
+typedef struct {
+    PyObject_HEAD
+    PyObject                   *names;
+    Py_ssize_t                  count;
+    struct _hexin_multi_entry  *entries;
+    PyThread_type_lock          lock;
+} hexin_MultiObject;
+
+/* One pass over pSrc, each block goes through every algorithm while it is still in cache. */
+static void hexin_multi_feed( hexin_MultiObject *self, const unsigned char *pSrc, unsigned long long len )
+{
+    struct _hexin_multi_entry *entry = NULL;
+    unsigned long long size = 0;
+    Py_ssize_t i = 0;
+
+    while ( len > 0 ) {
+        size = ( len < HEXIN_MULTI_BLOCK ) ? len : HEXIN_MULTI_BLOCK;
+        for ( i=0; i<self->count; i++ ) {
+            entry = &self->entries[i];
+            if ( entry->model != NULL ) {
+                entry->crc = hexin_model_update_long( entry->crc, pSrc, size, &entry->model->model );
+            } else {
+                entry->crc = hexin_crc32_adler_update( ( unsigned int )entry->crc, pSrc, ( unsigned int )size );
+            }
+        }
+        pSrc += size;
+        len  -= size;
+    }
+}
+
+static PyObject * hexin_multi_update_buffer( hexin_MultiObject *self, PyObject *obj )
+{
+    Py_buffer data = { NULL, NULL };
+
+    if ( PyObject_GetBuffer( obj, &data, PyBUF_SIMPLE ) < 0 ) {
+        return NULL;
+    }
+
+    if ( ( self->lock == NULL ) && ( data.len >= hexin_gil_threshold ) ) {
+        self->lock = PyThread_allocate_lock();
+    }
+
+    if ( ( self->lock != NULL ) && ( data.len >= hexin_gil_threshold ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock( self->lock, 1 );
+        hexin_multi_feed( self, (const unsigned char *)data.buf, (unsigned long long)data.len );
+        PyThread_release_lock( self->lock );
+        Py_END_ALLOW_THREADS
+    } else {
+        HEXIN_HASHER_ENTER( self );
+        hexin_multi_feed( self, (const unsigned char *)data.buf, (unsigned long long)data.len );
+        HEXIN_HASHER_LEAVE( self );
+    }
+
+    PyBuffer_Release( &data );
+
+    Py_RETURN_NONE;
+}
+
+static PyObject * hexin_multi_update( hexin_MultiObject *self, PyObject *args )
+{
+    PyObject *obj = NULL;
+
+    if ( !PyArg_ParseTuple( args, "O:update", &obj ) ) {
+        return NULL;
+    }
+
+    return hexin_multi_update_buffer( self, obj );
+}
+
+/* Every value so far as { name : int } or, with hex, { name : hex string }. */
+static PyObject * hexin_multi_values( hexin_MultiObject *self, unsigned int hex )
+{
+    PyObject *pdict = PyDict_New(), *pitem = NULL;
+    struct _hexin_multi_entry *entry = NULL;
+    unsigned long long *values = NULL;
+    unsigned int width = 0;
+    char buffer[17];
+    Py_ssize_t i = 0;
+
+    if ( pdict == NULL ) {
+        return NULL;
+    }
+
+    values = PyMem_New( unsigned long long, ( self->count > 0 ) ? self->count : 1 );
+    if ( values == NULL ) {
+        Py_DECREF( pdict );
+        return PyErr_NoMemory();
+    }
+
+    HEXIN_HASHER_ENTER( self );
+    for ( i=0; i<self->count; i++ ) {
+        entry = &self->entries[i];
+        values[i] = ( entry->model != NULL ) ? hexin_model_final( entry->crc, &entry->model->model ) : entry->crc;
+    }
+    HEXIN_HASHER_LEAVE( self );
+
+    for ( i=0; i<self->count; i++ ) {
+        width = ( self->entries[i].model != NULL ) ? self->entries[i].model->model.width : 32;
+        if ( hex ) {
+            PyOS_snprintf( buffer, sizeof( buffer ), "%0*llx", ( int )( ( width + 7 ) / 8 * 2 ), values[i] );
+#if PY_MAJOR_VERSION >= 3
+            pitem = PyUnicode_FromString( buffer );
+#else
+            pitem = PyString_FromString( buffer );
+#endif /* PY_MAJOR_VERSION */
+        } else {
+            pitem = PyLong_FromUnsignedLongLong( values[i] );
+        }
+        if ( ( pitem == NULL ) || ( PyDict_SetItem( pdict, PyTuple_GET_ITEM( self->names, i ), pitem ) < 0 ) ) {
+            Py_XDECREF( pitem );
+            Py_DECREF( pdict );
+            PyMem_Free( values );
+            return NULL;
+        }
+        Py_DECREF( pitem );
+    }
+
+    PyMem_Free( values );
+    return pdict;
+}
+
+static PyObject * hexin_multi_intdigests( hexin_MultiObject *self, PyObject *args )
+{
+    return hexin_multi_values( self, FALSE );
+}
+
+static PyObject * hexin_multi_hexdigests( hexin_MultiObject *self, PyObject *args )
+{
+    return hexin_multi_values( self, TRUE );
+}
+
+static hexin_MultiObject * hexin_multi_alloc( PyObject *names, Py_ssize_t count )
+{
+    hexin_MultiObject *multi = PyObject_New( hexin_MultiObject, &hexin_MultiType );
+
+    if ( multi == NULL ) {
+        return NULL;
+    }
+
+    Py_INCREF( names );
+    multi->names   = names;
+    multi->count   = 0;
+    multi->lock    = NULL;
+    multi->entries = PyMem_New( struct _hexin_multi_entry, ( count > 0 ) ? count : 1 );
+    if ( multi->entries == NULL ) {
+        Py_DECREF( multi );
+        return ( hexin_MultiObject * )PyErr_NoMemory();
+    }
+    return multi;
+}
+
+static PyObject * hexin_multi_copy( hexin_MultiObject *self, PyObject *args )
+{
+    hexin_MultiObject *copy = hexin_multi_alloc( self->names, self->count );
+    Py_ssize_t i = 0;
+
+    if ( copy == NULL ) {
+        return NULL;
+    }
+
+    HEXIN_HASHER_ENTER( self );
+    for ( i=0; i<self->count; i++ ) {
+        copy->entries[i] = self->entries[i];
+        Py_XINCREF( copy->entries[i].model );
+    }
+    HEXIN_HASHER_LEAVE( self );
+    copy->count = self->count;
+
+    return ( PyObject * )copy;
+}
+
+static void hexin_multi_dealloc( hexin_MultiObject *self )
+{
+    Py_ssize_t i = 0;
+
+    if ( self->lock != NULL ) {
+        PyThread_free_lock( self->lock );
+    }
+    for ( i=0; i<self->count; i++ ) {
+        Py_XDECREF( self->entries[i].model );
+    }
+    PyMem_Free( self->entries );
+    Py_XDECREF( self->names );
+    PyObject_Del( self );
+}
+
+/* Multi( algorithms, data=None ), algorithms is a sequence of ( name, Model ) or ( name, 'adler32' ). */
+static PyObject * hexin_multi_new( PyTypeObject *type, PyObject *args, PyObject *kws )
+{
+    PyObject *algorithms = NULL, *data = NULL, *fast = NULL, *names = NULL, *item = NULL, *kernel = NULL;
+    hexin_MultiObject *multi = NULL;
+    Py_ssize_t count = 0, i = 0;
+
+    static char* kwlist[]={ "algorithms", "data", NULL };
+
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "O|O:Multi", kwlist, &algorithms, &data ) ) {
+        return NULL;
+    }
+
+    fast = PySequence_Fast( algorithms, "algorithms must be a sequence of ( name, Model ) pairs" );
+    if ( fast == NULL ) {
+        return NULL;
+    }
+    count = PySequence_Fast_GET_SIZE( fast );
+
+    names = PyTuple_New( count );
+    if ( names == NULL ) {
+        Py_DECREF( fast );
+        return NULL;
+    }
+    multi = hexin_multi_alloc( names, count );
+    Py_DECREF( names );
+    if ( multi == NULL ) {
+        Py_DECREF( fast );
+        return NULL;
+    }
+
+    for ( i=0; i<count; i++ ) {
+        item = PySequence_Fast_GET_ITEM( fast, i );
+        if ( !PyTuple_Check( item ) || ( PyTuple_GET_SIZE( item ) != 2 ) ) {
+            PyErr_SetString( PyExc_TypeError, "algorithms must be a sequence of ( name, Model ) pairs" );
+            Py_DECREF( multi );
+            Py_DECREF( fast );
+            return NULL;
+        }
+
+        kernel = PyTuple_GET_ITEM( item, 1 );
+        if ( PyObject_TypeCheck( kernel, &hexin_ModelType ) ) {
+            Py_INCREF( kernel );
+            multi->entries[i].model = ( hexin_ModelObject * )kernel;
+            multi->entries[i].crc   = hexin_model_start( &multi->entries[i].model->model );
+#if PY_MAJOR_VERSION >= 3
+        } else if ( PyUnicode_Check( kernel ) && ( PyUnicode_CompareWithASCIIString( kernel, "adler32" ) == 0 ) ) {
+#else
+        } else if ( PyString_Check( kernel ) && ( strcmp( PyString_AS_STRING( kernel ), "adler32" ) == 0 ) ) {
+#endif /* PY_MAJOR_VERSION */
+            multi->entries[i].model = NULL;
+            multi->entries[i].crc   = 1;
+        } else {
+            PyErr_SetString( PyExc_TypeError, "every algorithm must be a Model or 'adler32'" );
+            Py_DECREF( multi );
+            Py_DECREF( fast );
+            return NULL;
+        }
+
+        Py_INCREF( PyTuple_GET_ITEM( item, 0 ) );
+        PyTuple_SET_ITEM( multi->names, i, PyTuple_GET_ITEM( item, 0 ) );
+        multi->count = i + 1;
+    }
+    Py_DECREF( fast );
+
+    if ( ( data != NULL ) && ( data != Py_None ) ) {
+        PyObject *ret = hexin_multi_update_buffer( multi, data );
+        if ( ret == NULL ) {
+            Py_DECREF( multi );
+            return NULL;
+        }
+        Py_DECREF( ret );
+    }
+
+    return ( PyObject * )multi;
+}
+
+static PyMethodDef hexin_multi_methods[] = {
+    { "update",     (PyCFunction)hexin_multi_update,     METH_VARARGS, "Feed a bytes-like object to every algorithm" },
+    { "intdigests", (PyCFunction)hexin_multi_intdigests, METH_NOARGS,  "Every value of the data so far as { name : int }" },
+    { "hexdigests", (PyCFunction)hexin_multi_hexdigests, METH_NOARGS,  "Every value of the data so far as { name : hex string }" },
+    { "copy",       (PyCFunction)hexin_multi_copy,       METH_NOARGS,  "Copy of the current state" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyMemberDef hexin_multi_members[] = {
+    { "names",  T_OBJECT, offsetof( hexin_MultiObject, names ), READONLY, "Names of the algorithms, in order" },
+    { NULL }        /* Sentinel */
+};
+
+static PyTypeObject hexin_MultiType = {
+    PyVarObject_HEAD_INIT( NULL, 0 )
+    .tp_name        = "libscrc.Multi",
+    .tp_basicsize   = sizeof( hexin_MultiObject ),
+    .tp_dealloc     = ( destructor )hexin_multi_dealloc,
+    .tp_flags       = Py_TPFLAGS_DEFAULT,
+    .tp_doc         = "Several CRCs / checksums of the same data in one pass, made by libscrc.multi_new()",
+    .tp_methods     = hexin_multi_methods,
+    .tp_members     = hexin_multi_members,
+    .tp_new         = hexin_multi_new,
+};
+
+static PyObject * _model_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t size = hexin_gil_threshold, previous = hexin_gil_threshold;
+
+    if ( !PyArg_ParseTuple( args, "|n", &size ) )
+        return NULL;
+
+    if ( size < 0 ) {
+        PyErr_SetString( PyExc_ValueError, "GIL threshold must not be negative" );
+        return NULL;
+    }
+
+    hexin_gil_threshold = size;
+    return Py_BuildValue( "n", previous );
+}
+
+/* method table */
+static PyMethodDef _modelMethods[] = {
+    { "_gil_threshold", (PyCFunction)_model_gil_threshold, METH_VARARGS, "Set the buffer size from which the GIL is released, returns the previous size" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+/* module documentation */
+PyDoc_STRVAR( _model_doc,
+"Compiled CRC models \n"
+"libscrc.Model      -> Model(width, poly, init=0, xorout=0, refin=False, refout=False), width 3 to 64\n"
+"libscrc.Hasher     -> Model.new(data=None), streaming CRC with update() / digest() / copy()\n"
+"Model.combine      -> combine(crc_a, crc_b, len_b), CRC of a+b from the CRCs of a and b\n"
+"Model.many         -> many(buffers, threads=0), array of the CRC of every buffer\n"
+"libscrc.Multi      -> Multi(algorithms, data=None), several CRCs of the same data in one pass\n"
+"\n" );
+
+
+#if PY_MAJOR_VERSION >= 3
+
+/* module definition structure */
+static struct PyModuleDef _modelmodule = {
+   PyModuleDef_HEAD_INIT,
+   "_model",                    /* name of module */
+   _model_doc,                  /* module documentation, may be NULL */
+   -1,                          /* size of per-interpreter state of the module */
+   _modelMethods
+};
+
+/* initialization function for Python 3 */
+PyMODINIT_FUNC
+PyInit__model( void )
+{
+    PyObject *m;
+
+    hexin_crc32c_sse42_init();
+    hexin_parallel_pool_init();
+    hexin_model_cache_lock = PyThread_allocate_lock();
+
+    if ( ( PyType_Ready( &hexin_ModelType ) < 0 ) || ( PyType_Ready( &hexin_HasherType ) < 0 ) || ( PyType_Ready( &hexin_MultiType ) < 0 ) ) {
+        return NULL;
+    }
+
+    m = PyModule_Create( &_modelmodule );
+    if ( m == NULL ) {
+        return NULL;
+    }
+
+    Py_INCREF( &hexin_ModelType );
+    PyModule_AddObject( m, "Model", ( PyObject * )&hexin_ModelType );
+    Py_INCREF( &hexin_HasherType );
+    PyModule_AddObject( m, "Hasher", ( PyObject * )&hexin_HasherType );
+    Py_INCREF( &hexin_MultiType );
+    PyModule_AddObject( m, "Multi", ( PyObject * )&hexin_MultiType );
+    PyModule_AddObject( m, "_C_API", PyCapsule_New( ( void * )&hexin_model_capi, HEXIN_MODEL_CAPSULE, NULL ) );
+
+    PyModule_AddStringConstant( m, "__version__", "1.3"  );
+    PyModule_AddStringConstant( m, "__author__",  "Heyn" );
+
+    return m;
+}
+
+#else
+
+/* initialization function for Python 2 */
+PyMODINIT_FUNC
+init_model( void )
+{
+    PyObject *m;
+
+    hexin_crc32c_sse42_init();
+    hexin_parallel_pool_init();
+    hexin_model_cache_lock = PyThread_allocate_lock();
+
+    if ( ( PyType_Ready( &hexin_ModelType ) < 0 ) || ( PyType_Ready( &hexin_HasherType ) < 0 ) || ( PyType_Ready( &hexin_MultiType ) < 0 ) ) {
+        return;
+    }
+
+    m = Py_InitModule3( "_model", _modelMethods, _model_doc );
+    if ( m == NULL ) {
+        return;
+    }
+
+    Py_INCREF( &hexin_ModelType );
+    PyModule_AddObject( m, "Model", ( PyObject * )&hexin_ModelType );
+    Py_INCREF( &hexin_HasherType );
+    PyModule_AddObject( m, "Hasher", ( PyObject * )&hexin_HasherType );
+    Py_INCREF( &hexin_MultiType );
+    PyModule_AddObject( m, "Multi", ( PyObject * )&hexin_MultiType );
+    PyModule_AddObject( m, "_C_API", PyCapsule_New( ( void * )&hexin_model_capi, HEXIN_MODEL_CAPSULE, NULL ) );
+}
+
+#endif /* PY_MAJOR_VERSION */
@@ -0,0 +1,207 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _modeltables.c
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize.
+*                      2026-10-17 [Heyn] New add hexin_model_combine(), CRC(A) and CRC(B) to CRC(AB) in O(log len(B)).
+*                      2026-10-17 [Heyn] New add hexin_model_shift(), the register after n zero bytes, and hexin_model_update_long().
+*                      2026-10-17 [Heyn] New add hexin_model_extend(), the CRC after n more zero bytes.
+*
+*********************************************************************************************************
+*/
+
+#include "_modeltables.h"
+
+#define                 HEXIN_MODEL_IS_WIDE(x)                  ( x->width > HEXIN_CRC32_WIDTH )
+
+static unsigned long long hexin_model_reflect( unsigned long long data, unsigned int width )
+{
+    return hexin_reverse64( data ) >> ( HEXIN_CRC64_WIDTH - width );
+}
+
+/*
+ * a * b mod P, both MSB-first in width bits ( the unreflected register ).
+ */
+unsigned long long hexin_model_multiply( unsigned long long a, unsigned long long b, const struct _hexin_model *model )
+{
+    unsigned long long product = 0;
+    unsigned long long top = 1ULL << ( model->width - 1 );
+    unsigned long long mask = HEXIN_MODEL_MASK( model->width );
+    unsigned int i = 0;
+
+    for ( i=model->width; i>0; i-- ) {
+        product = ( product & top ) ? ( ( ( product << 1 ) & mask ) ^ model->poly ) : ( ( product << 1 ) & mask );
+        if ( ( a >> ( i - 1 ) ) & 1 ) {
+            product ^= b;
+        }
+    }
+    return product;
+}
+
+/* x^(8n) mod P, one multiply per set bit of n. */
+unsigned long long hexin_model_xpow8n( unsigned long long n, const struct _hexin_model *model )
+{
+    unsigned long long result = 1;
+    unsigned int k = 0;
+
+    for ( k=0; n != 0; k++, n >>= 1 ) {
+        if ( n & 1 ) {
+            result = hexin_model_multiply( result, model->power[k], model );
+        }
+    }
+    return result;
+}
+
+static void hexin_model_init_power( struct _hexin_model *model )
+{
+    unsigned long long top = 1ULL << ( model->width - 1 );
+    unsigned long long mask = HEXIN_MODEL_MASK( model->width );
+    unsigned long long p = 1;
+    unsigned int k = 0;
+
+    /* x^8 mod P, a width below 8 already needs the reduction. */
+    for ( k=0; k<8; k++ ) {
+        p = ( p & top ) ? ( ( ( p << 1 ) & mask ) ^ model->poly ) : ( ( p << 1 ) & mask );
+    }
+
+    model->power[0] = p;
+    for ( k=1; k<HEXIN_MODEL_POWER_ARRAY; k++ ) {
+        model->power[k] = hexin_model_multiply( model->power[k - 1], model->power[k - 1], model );
+    }
+}
+
+/* Build the engine table once, the model is read-only afterwards. */
+unsigned int hexin_model_init( struct _hexin_model *model )
+{
+    hexin_model_init_power( model );
+
+    if ( HEXIN_MODEL_IS_WIDE( model ) ) {
+        model->engine.crc64.is_initial = FALSE;
+        model->engine.crc64.width      = model->width;
+        model->engine.crc64.poly       = model->poly;
+        model->engine.crc64.refin      = model->refin;
+        model->engine.crc64.refout     = model->refin;
+        return hexin_crc64_compute_init( &model->engine.crc64 );
+    }
+
+    model->engine.crc32.is_initial = FALSE;
+    model->engine.crc32.width      = model->width;
+    model->engine.crc32.poly       = ( unsigned int )model->poly;
+    model->engine.crc32.refin      = model->refin;
+    model->engine.crc32.refout     = model->refin;
+    return hexin_crc32_compute_init( &model->engine.crc32 );
+}
+
+/* The raw engine register holding init. */
+unsigned long long hexin_model_start( const struct _hexin_model *model )
+{
+    unsigned int offset = ( HEXIN_MODEL_IS_WIDE( model ) ? HEXIN_CRC64_WIDTH : HEXIN_CRC32_WIDTH ) - model->width;
+
+    if ( model->refin == TRUE ) {
+        return hexin_model_reflect( model->init, model->width );
+    }
+    return model->init << offset;
+}
+
+unsigned long long hexin_model_update( unsigned long long crc, const unsigned char *pSrc, unsigned int len, const struct _hexin_model *model )
+{
+    if ( HEXIN_MODEL_IS_WIDE( model ) ) {
+        return hexin_crc64_update( crc, pSrc, len, &model->engine.crc64 );
+    }
+    return hexin_crc32_update( ( unsigned int )crc, pSrc, len, &model->engine.crc32 );
+}
+
+/* The engines take an unsigned int length, longer buffers go through in 1GB pieces. */
+unsigned long long hexin_model_update_long( unsigned long long crc, const unsigned char *pSrc, unsigned long long len, const struct _hexin_model *model )
+{
+    unsigned int size = 0;
+
+    while ( len > 0 ) {
+        size = ( len > HEXIN_MODEL_UPDATE_MAXSIZE ) ? HEXIN_MODEL_UPDATE_MAXSIZE : ( unsigned int )len;
+        crc  = hexin_model_update( crc, pSrc, size, model );
+        pSrc += size;
+        len  -= size;
+    }
+    return crc;
+}
+
+/* Raw engine register to the CRC value. */
+unsigned long long hexin_model_final( unsigned long long crc, const struct _hexin_model *model )
+{
+    unsigned int offset = ( HEXIN_MODEL_IS_WIDE( model ) ? HEXIN_CRC64_WIDTH : HEXIN_CRC32_WIDTH ) - model->width;
+
+    if ( model->refin != TRUE ) {
+        crc = crc >> offset;
+    }
+
+    if ( model->refin != model->refout ) {
+        crc = hexin_model_reflect( crc, model->width );
+    }
+
+    return ( crc ^ model->xorout ) & HEXIN_MODEL_MASK( model->width );
+}
+
+unsigned long long hexin_model_compute( const unsigned char *pSrc, unsigned int len, const struct _hexin_model *model )
+{
+    return hexin_model_final( hexin_model_update( hexin_model_start( model ), pSrc, len, model ), model );
+}
+
+/*
+ * CRC(A) and CRC(B) to CRC(AB). With r the unreflected register after A, CRC(AB) is
+ * CRC(B) ^ out( ( r ^ init ) * x^(8 * len2) mod P ), out being refout and nothing else.
+ */
+unsigned long long hexin_model_combine( unsigned long long crc1, unsigned long long crc2, unsigned long long len2,
+                                        const struct _hexin_model *model )
+{
+    unsigned long long r = crc1 ^ model->xorout;
+
+    if ( model->refout == TRUE ) {
+        r = hexin_model_reflect( r, model->width );
+    }
+
+    r = hexin_model_multiply( r ^ model->init, hexin_model_xpow8n( len2, model ), model );
+
+    if ( model->refout == TRUE ) {
+        r = hexin_model_reflect( r, model->width );
+    }
+
+    return crc2 ^ r;
+}
+
+/* CRC of the same data followed by n zero bytes, in O(log n). */
+unsigned long long hexin_model_extend( unsigned long long crc, unsigned long long n, const struct _hexin_model *model )
+{
+    unsigned long long r = crc ^ model->xorout;
+
+    if ( model->refout == TRUE ) {
+        r = hexin_model_reflect( r, model->width );
+    }
+
+    r = hexin_model_multiply( r, hexin_model_xpow8n( n, model ), model );
+
+    if ( model->refout == TRUE ) {
+        r = hexin_model_reflect( r, model->width );
+    }
+
+    return r ^ model->xorout;
+}
+
+/* The raw engine register after n zero bytes, in O(log n). */
+unsigned long long hexin_model_shift( unsigned long long crc, unsigned long long n, const struct _hexin_model *model )
+{
+    unsigned int offset = ( HEXIN_MODEL_IS_WIDE( model ) ? HEXIN_CRC64_WIDTH : HEXIN_CRC32_WIDTH ) - model->width;
+
+    if ( model->refin == TRUE ) {
+        crc = hexin_model_multiply( hexin_model_reflect( crc, model->width ), hexin_model_xpow8n( n, model ), model );
+        return hexin_model_reflect( crc, model->width );
+    }
+
+    crc = hexin_model_multiply( crc >> offset, hexin_model_xpow8n( n, model ), model );
+    return crc << offset;
+}
@@ -0,0 +1,75 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2026, Hexin
+*                                           All Rights Reserved
+* File    : _modeltables.h
+* Author  : Heyn (heyunhuan@gmail.com)
+* Version : V1.3
+*
+* LICENSING TERMS:
+* ---------------
+*		New Create at 	2026-10-17 [Heyn] Initialize.
+*                      2026-10-17 [Heyn] New add hexin_model_combine(), x^(8*2^k) mod P powers.
+*                      2026-10-17 [Heyn] New add hexin_model_shift() / hexin_model_update_long().
+*                      2026-10-17 [Heyn] New add hexin_model_extend().
+*
+*   SEE : https://reveng.sourceforge.io/crc-catalogue/all.htm
+*
+*********************************************************************************************************
+*/
+
+#ifndef __MODEL_TABLES_H__
+#define __MODEL_TABLES_H__
+
+#include "_crc32tables.h"
+#include "_crc32simd.h"
+
+/* Both engines define it for their own width, the model uses neither. */
+#undef HEXIN_POLYNOMIAL_IS_HIGH
+#include "_crc64tables.h"
+
+#define                 HEXIN_MODEL_WIDTH_MIN                   3
+#define                 HEXIN_MODEL_WIDTH_MAX                   64
+
+/* x^(8*2^k) mod P for k below this covers any 64-bit byte count. */
+#define                 HEXIN_MODEL_POWER_ARRAY                 64
+
+#define                 HEXIN_MODEL_UPDATE_MAXSIZE              0x40000000
+
+#define                 HEXIN_MODEL_MASK(w)                     ( ( w ) == 64 ? 0xFFFFFFFFFFFFFFFFULL : ( ( 1ULL << ( w ) ) - 1 ) )
+
+/*
+ * A Rocksoft model of any width from 3 to 64. Widths up to 32 run on the CRC32 engine
+ * ( slicing-by-8, PCLMULQDQ, SSE4.2 ), wider ones on the CRC64 engine. The engine only
+ * sees the table parameters, init / xorout and a refin != refout pair are applied here.
+ */
+struct _hexin_model {
+    unsigned int  width;
+    unsigned long long  poly;
+    unsigned long long  init;
+    unsigned long long  xorout;
+    unsigned int  refin;
+    unsigned int  refout;
+    unsigned long long  power[HEXIN_MODEL_POWER_ARRAY];
+    union {
+        struct _hexin_crc32  crc32;
+        struct _hexin_crc64  crc64;
+    } engine;
+};
+
+unsigned int       hexin_model_init(    struct _hexin_model *model );
+unsigned long long hexin_model_start(   const struct _hexin_model *model );
+unsigned long long hexin_model_update(  unsigned long long crc, const unsigned char *pSrc, unsigned int len, const struct _hexin_model *model );
+unsigned long long hexin_model_final(   unsigned long long crc, const struct _hexin_model *model );
+unsigned long long hexin_model_compute( const unsigned char *pSrc, unsigned int len, const struct _hexin_model *model );
+
+unsigned long long hexin_model_update_long( unsigned long long crc, const unsigned char *pSrc, unsigned long long len, const struct _hexin_model *model );
+unsigned long long hexin_model_shift(    unsigned long long crc, unsigned long long n, const struct _hexin_model *model );
+
+unsigned long long hexin_model_multiply( unsigned long long a, unsigned long long b, const struct _hexin_model *model );
+unsigned long long hexin_model_xpow8n(   unsigned long long n, const struct _hexin_model *model );
+unsigned long long hexin_model_extend( unsigned long long crc, unsigned long long n, const struct _hexin_model *model );
+unsigned long long hexin_model_combine(  unsigned long long crc1, unsigned long long crc2, unsigned long long len2,
+                                         const struct _hexin_model *model );
+
+#endif //__MODEL_TABLES_H__